@@ -12,7 +12,7 @@
 
 namespace Scintilla {
 
-enum { dvRelease4 = 2 };
+enum { dvRelease4 = 2, dvRelease5 = 3 };
 
 class LEXILLA_EXPORT IDocument {
 public:
@@ -43,6 +43,15 @@ public:
   virtual int SCI_METHOD GetCharacterAndWidth(Sci_Position position, Sci_Position *pWidth) const = 0;
 };
 
+// Documents returning dvRelease5 or later from Version implement IDocumentRange so that
+// lexers may read text in place. Text before and after GapPosition is contiguous and a
+// RangePointer to a range that does not cross GapPosition is valid until the document is modified.
+class LEXILLA_EXPORT IDocumentRange : public IDocument {
+public:
+  virtual Sci_Position SCI_METHOD GapPosition() const = 0;
+  virtual const char *SCI_METHOD RangePointer(Sci_Position position, Sci_Position rangeLength) = 0;
+};
+
 enum { lvRelease4 = 2, lvRelease5 = 3 };
 
 class LEXILLA_EXPORT ILexer4 {
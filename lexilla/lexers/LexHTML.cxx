@@ -1492,9 +1492,11 @@ void SCI_METHOD LexerHTML::Lex(Sci_PositionU startPos, Sci_Position length, int
 		/////////////////////////////////////
 		// handle the start of PHP pre-processor = Non-HTML
 		else if ((ch == '<') && (chNext == '?') && IsPHPEntryState(state) && IsPHPStart(allowPHP, styler, i)) {
- 			beforeLanguage = scriptLanguage;
-			scriptLanguage = segIsScriptingIndicator(styler, i + 2, i + 6, isXml ? eScriptXML : eScriptPHP);
-			if ((scriptLanguage != eScriptPHP) && (isStringState(state) || (state==SCE_H_COMMENT))) continue;
+			const script_type preProcLanguage = segIsScriptingIndicator(styler, i + 2, i + 6, isXml ? eScriptXML : eScriptPHP);
+			// Only PHP starts inside strings and comments; anything else stays in the current language
+			if ((preProcLanguage != eScriptPHP) && (isStringState(state) || (state==SCE_H_COMMENT))) continue;
+			beforeLanguage = scriptLanguage;
+			scriptLanguage = preProcLanguage;
 			styler.ColourTo(i - 1, StateToPrint);
 			beforePreProc = state;
 			i++;
@@ -1619,14 +1621,18 @@ void SCI_METHOD LexerHTML::Lex(Sci_PositionU startPos, Sci_Position length, int
 		// handle the start of ASP pre-processor = Non-HTML
 		else if ((ch == '<') && (chNext == '%') && allowASP && !isCommentASPState(state) && !isPHPStringState(state)) {
 			styler.ColourTo(i - 1, StateToPrint);
-			beforePreProc = state;
-			if (inScriptType == eNonHtmlScript)
-				inScriptType = eNonHtmlScriptPreProc;
-			else
-				inScriptType = eNonHtmlPreProc;
-			// fold whole script
-			if (foldHTMLPreprocessor)
-				levelCurrent++;
+			// An unterminated block is replaced by the new one which returns to the state
+			// before the unterminated block when it ends.
+			if ((inScriptType != eNonHtmlPreProc) && (inScriptType != eNonHtmlScriptPreProc)) {
+				beforePreProc = state;
+				if (inScriptType == eNonHtmlScript)
+					inScriptType = eNonHtmlScriptPreProc;
+				else
+					inScriptType = eNonHtmlPreProc;
+				// fold whole script
+				if (foldHTMLPreprocessor)
+					levelCurrent++;
+			}
 			if (chNext2 == '@') {
 				i += 2; // place as if it was the second next char treated
 				visibleChars += 2;
@@ -41,7 +41,7 @@ public:
     if (static_cast<size_t>(character) < dense.size()) {
       return static_cast<CharacterCategory>(dense[character]);
     } else {
-      // binary search through ranges
+      // two-stage table lookup by block of characters
       return CategoriseCharacter(character);
     }
   }
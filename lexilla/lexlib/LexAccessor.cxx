@@ -32,7 +32,7 @@ void LexAccessor::GetRange(Sci_PositionU startPos_, Sci_PositionU endPos_, char
   endPos_ = std::min(endPos_, startPos_ + len - 1);
   len = endPos_ - startPos_;
   if (startPos_ >= static_cast<Sci_PositionU>(startPos) && endPos_ <= static_cast<Sci_PositionU>(endPos)) {
-    const char *const p = buf + (startPos_ - startPos);
+    const char *const p = text + (startPos_ - startPos);
     memcpy(s, p, len);
   } else {
     pAccess->GetCharRange(s, startPos_, len);
@@ -52,7 +52,8 @@ void LexAccessor::GetRangeLowered(Sci_PositionU startPos_, Sci_PositionU endPos_
 }
 
 std::string LexAccessor::GetRange(Sci_PositionU startPos_, Sci_PositionU endPos_) {
-  assert(startPos_ < endPos_);
+  // Empty ranges occur for empty words and return an empty string
+  assert(startPos_ <= endPos_);
   const Sci_PositionU len = endPos_ - startPos_;
   std::string s(len, '\0');
   GetRange(startPos_, endPos_, s.data(), len + 1);
@@ -60,7 +61,7 @@ std::string LexAccessor::GetRange(Sci_PositionU startPos_, Sci_PositionU endPos_
 }
 
 std::string LexAccessor::GetRangeLowered(Sci_PositionU startPos_, Sci_PositionU endPos_) {
-  assert(startPos_ < endPos_);
+  assert(startPos_ <= endPos_);
   const Sci_PositionU len = endPos_ - startPos_;
   std::string s(len, '\0');
   GetRangeLowered(startPos_, endPos_, s.data(), len + 1);
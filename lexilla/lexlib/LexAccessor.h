@@ -8,7 +8,9 @@
 // The License.txt file describes the conditions under which this software may be distributed.
 
 #include <assert.h>
+#include <algorithm>
 #include <string>
+#include <vector>
 #include "ILexer.h"
 #include "lexilla_globals.h"
 
@@ -19,13 +21,17 @@ enum class EncodingType { eightBit, unicode, dbcs };
 class LEXILLA_EXPORT LexAccessor {
 private:
   Scintilla::IDocument *pAccess;
+  // Set when the document can lend its text so reading does not need to copy
+  Scintilla::IDocumentRange *pRange;
   enum { extremePosition = 0x7FFFFFFF };
   /** @a bufferSize is a trade off between time taken to copy the characters
-   * and retrieval overhead.
+   * and retrieval overhead. It is also the number of styles sent in each SetStyles call.
    * @a slopSize positions the buffer before the desired position
    * in case there is some backtracking. */
-  enum { bufferSize = 4000, slopSize = bufferSize / 8 };
-  char buf[bufferSize + 1];
+  enum { bufferSize = 16000, slopSize = bufferSize / 8 };
+  // Text of [startPos, endPos) either borrowed from the document or copied into buf
+  const char *text;
+  std::vector<char> buf;
   Sci_Position startPos;
   Sci_Position endPos;
   int codePage;
@@ -38,24 +44,50 @@ private:
   int documentVersion;
 
   void Fill(Sci_Position position) {
+    if (pRange && (position >= 0) && (position < lenDoc)) {
+      // Borrow the contiguous part of the document on the same side of the gap as position
+      const Sci_Position gap = pRange->GapPosition();
+      startPos = (position < gap) ? 0 : gap;
+      endPos = (position < gap) ? gap : lenDoc;
+      text = pRange->RangePointer(startPos, endPos - startPos);
+      return;
+    }
+
     startPos = position - slopSize;
     if (startPos + bufferSize > lenDoc) startPos = lenDoc - bufferSize;
     if (startPos < 0) startPos = 0;
     endPos = startPos + bufferSize;
     if (endPos > lenDoc) endPos = lenDoc;
 
-    pAccess->GetCharRange(buf, startPos, endPos - startPos);
+    if (buf.empty()) buf.resize(bufferSize + 1);
+    pAccess->GetCharRange(buf.data(), startPos, endPos - startPos);
     buf[endPos - startPos] = '\0';
+    text = buf.data();
+  }
+
+  // Calls that may send notifications can let a handler move the gap so a borrowed
+  // pointer is dropped and borrowed again on the next read.
+  void ReleaseText() noexcept {
+    if (pRange) {
+      startPos = extremePosition;
+      endPos = 0;
+      text = nullptr;
+    }
   }
 
 public:
+  /** Documents that implement IDocumentRange are read in place. Other documents are copied
+   * through a window of bufferSize bytes. The document must not be modified while a
+   * LexAccessor is reading it. */
   explicit LexAccessor(Scintilla::IDocument *pAccess_)
-      : pAccess(pAccess_), startPos(extremePosition), endPos(0), codePage(pAccess->CodePage()),
-        encodingType(EncodingType::eightBit), lenDoc(pAccess->Length()), validLen(0), startSeg(0), startPosStyling(0),
-        documentVersion(pAccess->Version()) {
-    // Prevent warnings by static analyzers about uninitialized buf and styleBuf.
-    buf[0] = 0;
+      : pAccess(pAccess_), pRange(nullptr), text(nullptr), startPos(extremePosition), endPos(0),
+        codePage(pAccess->CodePage()), encodingType(EncodingType::eightBit), lenDoc(pAccess->Length()), validLen(0),
+        startSeg(0), startPosStyling(0), documentVersion(pAccess->Version()) {
+    // Prevent warnings by static analyzers about uninitialized styleBuf.
     styleBuf[0] = 0;
+    if (documentVersion >= Scintilla::dvRelease5) {
+      pRange = static_cast<Scintilla::IDocumentRange *>(pAccess);
+    }
     switch (codePage) {
     case 65001: encodingType = EncodingType::unicode; break;
     case 932:
@@ -66,11 +98,12 @@ public:
     default: break;
     }
   }
+  static constexpr Sci_Position BufferSize() noexcept { return bufferSize; }
   char operator[](Sci_Position position) {
     if (position < startPos || position >= endPos) {
       Fill(position);
     }
-    return buf[position - startPos];
+    return text[position - startPos];
   }
   Scintilla::IDocument *MultiByteAccess() const noexcept { return pAccess; }
   /** Safe version of operator[], returning a defined value for invalid position. */
@@ -82,7 +115,7 @@ public:
         return chDefault;
       }
     }
-    return buf[position - startPos];
+    return text[position - startPos];
   }
   bool IsLeadByte(char ch) const {
     const unsigned char uch = ch;
@@ -134,10 +167,15 @@ public:
       pAccess->SetStyles(validLen, styleBuf);
       startPosStyling += validLen;
       validLen = 0;
+      ReleaseText();
     }
   }
   int GetLineState(Sci_Position line) const { return pAccess->GetLineState(line); }
-  int SetLineState(Sci_Position line, int state) { return pAccess->SetLineState(line, state); }
+  int SetLineState(Sci_Position line, int state) {
+    const int previous = pAccess->SetLineState(line, state);
+    ReleaseText();
+    return previous;
+  }
   // Style setting
   void StartAt(Sci_PositionU start) {
     pAccess->StartStyling(start);
@@ -153,23 +191,29 @@ public:
         return;
       }
 
-      if (validLen + (pos - startSeg + 1) >= bufferSize) Flush();
+      const Sci_Position lengthSegment = pos - startSeg + 1;
+      if (validLen + lengthSegment >= bufferSize) Flush();
       const unsigned char attr = chAttr & 0xffU;
       // Too big for buffer so send directly
-      if (validLen + (pos - startSeg + 1) >= bufferSize) pAccess->SetStyleFor(pos - startSeg + 1, attr);
-      else {
-        for (Sci_PositionU i = startSeg; i <= pos; i++) {
-          assert((startPosStyling + validLen) < Length());
-          styleBuf[validLen++] = attr;
-        }
+      if (validLen + lengthSegment >= bufferSize) {
+        pAccess->SetStyleFor(lengthSegment, attr);
+        ReleaseText();
+      } else {
+        assert((startPosStyling + validLen + lengthSegment) <= Length());
+        std::fill_n(styleBuf + validLen, lengthSegment, attr);
+        validLen += lengthSegment;
       }
     }
     startSeg = pos + 1;
   }
-  void SetLevel(Sci_Position line, int level) { pAccess->SetLevel(line, level); }
+  void SetLevel(Sci_Position line, int level) {
+    pAccess->SetLevel(line, level);
+    ReleaseText();
+  }
   void IndicatorFill(Sci_Position start, Sci_Position end, int indicator, int value) {
     pAccess->DecorationSetCurrentIndicator(indicator);
     pAccess->DecorationFillRange(start, value, end - start);
+    ReleaseText();
   }
 
   void ChangeLexerState(Sci_Position start, Sci_Position end) { pAccess->ChangeLexerState(start, end); }
@@ -13,10 +13,39 @@
 
 using namespace Lexilla;
 
+namespace {
+
+// Number of bytes in a UTF-8 sequence indexed by its lead byte, 0 for bytes that can not start
+// a well-formed multi-byte sequence: trail bytes, overlong C0/C1 and beyond-Unicode F5..FF.
+struct UTF8LeadWidths {
+  unsigned char widths[256]{};
+  constexpr UTF8LeadWidths() noexcept {
+    for (int lead = 0; lead < 0x80; lead++) widths[lead] = 1;
+    for (int lead = 0xC2; lead < 0xE0; lead++) widths[lead] = 2;
+    for (int lead = 0xE0; lead < 0xF0; lead++) widths[lead] = 3;
+    for (int lead = 0xF0; lead < 0xF5; lead++) widths[lead] = 4;
+  }
+};
+constexpr UTF8LeadWidths utf8LeadWidths;
+
+constexpr bool IsTrail(unsigned char ch) noexcept { return (ch & 0xC0) == 0x80; }
+
+// Overlong forms, surrogates and non-characters are reported by the document as invalid.
+constexpr bool IsValidDecoded(int character, int width) noexcept {
+  if (width == 2) return true;
+  if ((character >= 0xFDD0) && (character <= 0xFDEF)) return false;
+  if ((character & 0xFFFE) == 0xFFFE) return false;
+  if (width == 3) return (character >= 0x800) && ((character < 0xD800) || (character > 0xDFFF));
+  return (character >= 0x10000) && (character <= 0x10FFFF);
+}
+
+} // namespace
+
 StyleContext::StyleContext(Sci_PositionU startPos, Sci_PositionU length, int initStyle, LexAccessor &styler_,
                            char chMask)
     : styler(styler_),
       multiByteAccess((styler.Encoding() == EncodingType::eightBit) ? nullptr : styler.MultiByteAccess()),
+      utf8(styler.Encoding() == EncodingType::unicode),
       lengthDocument(static_cast<Sci_PositionU>(styler.Length())),
       endPos(((startPos + length) < lengthDocument) ? (startPos + length) : (lengthDocument + 1)),
       lineDocEnd(styler.GetLine(lengthDocument)), currentPosLastRelative(SIZE_MAX), currentPos(startPos),
@@ -39,6 +68,36 @@ StyleContext::StyleContext(Sci_PositionU startPos, Sci_PositionU length, int ini
   GetNextChar();
 }
 
+int StyleContext::GetCharacterUTF8(Sci_Position position, Sci_Position *pWidth) {
+  const unsigned char lead = styler.SafeGetCharAt(position, 0);
+  const int widthLead = utf8LeadWidths.widths[lead];
+  if (widthLead >= 2) {
+    // Bytes past the end of the document are read as NUL which is not a trail byte
+    const unsigned char trail1 = styler.SafeGetCharAt(position + 1, 0);
+    const unsigned char trail2 = (widthLead >= 3) ? styler.SafeGetCharAt(position + 2, 0) : 0x80;
+    const unsigned char trail3 = (widthLead >= 4) ? styler.SafeGetCharAt(position + 3, 0) : 0x80;
+    if (IsTrail(trail1) && IsTrail(trail2) && IsTrail(trail3)) {
+      int character = 0;
+      switch (widthLead) {
+      case 2: character = ((lead & 0x1F) << 6) | (trail1 & 0x3F); break;
+      case 3: character = ((lead & 0x0F) << 12) | ((trail1 & 0x3F) << 6) | (trail2 & 0x3F); break;
+      default:
+        character = ((lead & 0x07) << 18) | ((trail1 & 0x3F) << 12) | ((trail2 & 0x3F) << 6) | (trail3 & 0x3F);
+        break;
+      }
+      if (IsValidDecoded(character, widthLead)) {
+        if (pWidth) *pWidth = widthLead;
+        return character;
+      }
+    }
+  } else if (widthLead == 1) {
+    if (pWidth) *pWidth = 1;
+    return lead;
+  }
+  // Let the document decide how to report invalid bytes
+  return multiByteAccess->GetCharacterAndWidth(position, pWidth);
+}
+
 bool StyleContext::MatchIgnoreCase(const char *s) {
   if (MakeLowerCase(ch) != static_cast<unsigned char>(*s)) return false;
   s++;
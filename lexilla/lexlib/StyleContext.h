@@ -19,6 +19,8 @@ namespace Lexilla {
 class LEXILLA_EXPORT StyleContext {
   LexAccessor &styler;
   Scintilla::IDocument *const multiByteAccess;
+  // UTF-8 is decoded from the accessor's buffer, only asking the document about invalid sequences.
+  const bool utf8;
   const Sci_PositionU lengthDocument;
   const Sci_PositionU endPos;
   const Sci_Position lineDocEnd;
@@ -28,8 +30,18 @@ class LEXILLA_EXPORT StyleContext {
   Sci_PositionU currentPosLastRelative;
   Sci_Position offsetRelative = 0;
 
+  int GetCharacterUTF8(Sci_Position position, Sci_Position *pWidth);
+
   void GetNextChar() {
-    if (multiByteAccess) {
+    if (utf8) {
+      const unsigned char leadNext = styler.SafeGetCharAt(currentPos + width, 0);
+      if (leadNext < 0x80) {
+        chNext = leadNext;
+        widthNext = 1;
+      } else {
+        chNext = GetCharacterUTF8(currentPos + width, &widthNext);
+      }
+    } else if (multiByteAccess) {
       chNext = multiByteAccess->GetCharacterAndWidth(currentPos + width, &widthNext);
     } else {
       const unsigned char charNext = styler.SafeGetCharAt(currentPos + width, 0);
@@ -123,6 +135,25 @@ public:
   }
   int GetRelativeCharacter(Sci_Position n) {
     if (n == 0) return ch;
+    if (utf8) {
+      // Within a run of ASCII each character is one byte so the document need not be walked
+      const Sci_Position posSigned = currentPos;
+      if ((n > 0) && (ch < 0x80) && (posSigned + n < styler.Length())) {
+        Sci_Position i = 1;
+        while ((i < n) && (static_cast<unsigned char>(styler[currentPos + i]) < 0x80))
+          i++;
+        if (i == n) {
+          const unsigned char lead = styler[currentPos + n];
+          return (lead < 0x80) ? lead : GetCharacterUTF8(currentPos + n, nullptr);
+        }
+      } else if ((n < 0) && (posSigned + n >= 0)) {
+        Sci_Position i = -1;
+        while ((i > n) && (static_cast<unsigned char>(styler[currentPos + i]) < 0x80))
+          i--;
+        const unsigned char chRelative = styler[currentPos + n];
+        if ((i == n) && (chRelative < 0x80)) return chRelative;
+      }
+    }
     if (multiByteAccess) {
       if ((currentPosLastRelative != currentPos) || ((n > 0) && ((offsetRelative < 0) || (n < offsetRelative))) ||
           ((n < 0) && ((offsetRelative > 0) || (n > offsetRelative)))) {
@@ -127,6 +127,31 @@ void TestDocument::Set(std::string_view sv) {
 	lineLevels.resize(lineStarts.size(), 0x400);
 }
 
+void TestDocument::Insert(Sci_Position position, std::string_view sv) {
+	const Sci_Position line = LineFromPosition(position);
+	const Sci_Position insertLength = sv.length();
+	text.insert(position, sv);
+	textStyles.insert(position, insertLength, '\0');
+	for (size_t lineAfter = line + 1; lineAfter < lineStarts.size(); lineAfter++) {
+		lineStarts[lineAfter] += insertLength;
+	}
+	std::vector<Sci_Position> starts;
+	for (Sci_Position pos = 0; pos < insertLength; pos++) {
+		if (sv[pos] == '\n') {
+			starts.push_back(position + pos + 1);
+		}
+	}
+	lineStarts.insert(lineStarts.begin() + line + 1, starts.begin(), starts.end());
+	lineStates.insert(lineStates.begin() + line + 1, starts.size(), 0);
+	lineLevels.insert(lineLevels.begin() + line + 1, starts.size(), 0x400);
+	if (lineStarts.back() != Length()) {
+		lineStarts.push_back(Length());
+		lineStates.resize(lineStarts.size() + 1);
+		lineLevels.resize(lineStarts.size(), 0x400);
+	}
+	endStyled = std::min(endStyled, position);
+}
+
 #if defined(_MSC_VER)
 // IDocument interface does not specify noexcept so best to not add it to implementation
 #pragma warning(disable: 26440)
@@ -137,7 +162,7 @@ Sci_Position TestDocument::MaxLine() const noexcept {
 }
 
 int SCI_METHOD TestDocument::Version() const {
-	return Scintilla::dvRelease4;
+	return Scintilla::dvRelease5;
 }
 
 void SCI_METHOD TestDocument::SetErrorStatus(int) {
@@ -246,6 +271,17 @@ const char *SCI_METHOD TestDocument::BufferPointer() {
 	return text.c_str();
 }
 
+Sci_Position SCI_METHOD TestDocument::GapPosition() const {
+	// The text is contiguous but pretend there is a gap in the middle so that
+	// lexers are exercised reading ranges from both sides of it.
+	return Length() / 2;
+}
+
+const char *SCI_METHOD TestDocument::RangePointer(Sci_Position position, Sci_Position rangeLength) {
+	assert((position + rangeLength <= GapPosition()) || (position >= GapPosition()));
+	return text.c_str() + position;
+}
+
 int SCI_METHOD TestDocument::GetLineIndentation(Sci_Position) {
 	// Never actually called - lexers use Accessor::IndentAmount
 	return 0;
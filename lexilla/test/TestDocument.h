@@ -14,7 +14,7 @@
 
 std::u32string UTF32FromUTF8(std::string_view svu8);
 
-class TestDocument : public Scintilla::IDocument {
+class TestDocument : public Scintilla::IDocumentRange {
 	std::string text;
 	std::string textStyles;
 	std::vector<Sci_Position> lineStarts;
@@ -23,6 +23,8 @@ class TestDocument : public Scintilla::IDocument {
 	Sci_Position endStyled=0;
 public:
 	void Set(std::string_view sv);
+	// Insert text as an edit would, keeping existing styles, line states and fold levels.
+	void Insert(Sci_Position position, std::string_view sv);
 	TestDocument() = default;
 	// Deleted so TestDocument objects can not be copied.
 	TestDocument(const TestDocument&) = delete;
@@ -57,6 +59,8 @@ public:
 	Sci_Position SCI_METHOD LineEnd(Sci_Position line) const override;
 	Sci_Position SCI_METHOD GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const override;
 	int SCI_METHOD GetCharacterAndWidth(Sci_Position position, Sci_Position *pWidth) const override;
+	Sci_Position SCI_METHOD GapPosition() const override;
+	const char *SCI_METHOD RangePointer(Sci_Position position, Sci_Position rangeLength) override;
 };
 
 #endif
@@ -6,6 +6,7 @@
  // The License.txt file describes the conditions under which this software may be distributed.
 
 #include <cassert>
+#include <cstdlib>
 
 #include <string>
 #include <string_view>
@@ -13,6 +14,10 @@
 #include <map>
 #include <optional>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <new>
 
 #include <iostream>
 #include <sstream>
@@ -29,6 +34,47 @@
 
 namespace {
 
+// Allocations made through the global operator new, reported when benchmarking.
+// Only counted in lexilla_bench which defines LEXILLA_BENCHMARK so the replacement
+// operator new is not part of the correctness run.
+// Allocations made inside a Windows DLL do not pass through this replacement.
+#if defined(LEXILLA_BENCHMARK)
+constexpr bool countAllocations = true;
+#else
+constexpr bool countAllocations = false;
+#endif
+std::atomic<size_t> allocationCount = 0;
+
+}
+
+#if defined(LEXILLA_BENCHMARK)
+
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC warns about free after inlining the replaced operator delete into callers
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(std::size_t size) {
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	void *p = std::malloc(size ? size : 1);
+	if (!p) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void operator delete(void *p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+	std::free(p);
+}
+
+#endif
+
+namespace {
+
 constexpr char MakeLowerCase(char c) noexcept {
 	if (c >= 'A' && c <= 'Z') {
 		return c - 'A' + 'a';
@@ -956,6 +1002,252 @@ bool AccessLexilla(std::filesystem::path basePath) {
 	return success;
 }
 
+// Benchmarking lexers on large documents synthesised by repeating each example.
+
+struct BenchmarkOptions {
+	size_t size = 4 * 1024 * 1024;
+	int edits = 100;
+	unsigned int seed = 1;
+	std::string lexer;
+	std::filesystem::path report = "benchmark.json";
+};
+
+struct BenchmarkResult {
+	std::string file;
+	std::string lexer;
+	size_t length = 0;
+	double lexMBPerSecond = 0.0;
+	double foldMBPerSecond = 0.0;
+	double editMicroseconds = 0.0;
+	double editMicrosecondsMax = 0.0;
+	size_t allocationsLex = 0;
+	size_t allocationsFold = 0;
+	double allocationsEdit = 0.0;
+};
+
+// Lines restyled after each edit, approximating a window redrawing the lines after the change.
+constexpr Sci_Position benchmarkScreenLines = 100;
+
+// Full lexes and folds are repeated and the fastest taken to reduce noise.
+constexpr int benchmarkRepeats = 3;
+
+// Characters inserted by edits, including ones that start strings and comments.
+constexpr std::string_view editCharacters = "a0 _;.(){}[]<>\"'/*#$-";
+
+class Stopwatch {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+public:
+	double Seconds() const noexcept {
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count();
+	}
+};
+
+std::string SynthesiseText(std::string_view example, size_t size) {
+	std::string text;
+	if (example.empty()) {
+		return text;
+	}
+	text.reserve(size + example.length() + 1);
+	while (text.length() < size) {
+		text.append(example);
+		if (text.back() != '\n') {
+			text.push_back('\n');
+		}
+	}
+	return text;
+}
+
+double MBPerSecond(size_t length, double seconds) noexcept {
+	return (seconds > 0.0) ? (length / (1024.0 * 1024.0) / seconds) : 0.0;
+}
+
+std::optional<BenchmarkResult> BenchmarkFile(const std::filesystem::path &path, const std::filesystem::path &relativePath,
+	const PropertyMap &propertyMap, const BenchmarkOptions &options) {
+	std::optional<std::string> language = propertyMap.GetPropertyForFile(lexerPrefix, path.filename().string());
+	if (!language || (!options.lexer.empty() && (*language != options.lexer))) {
+		return {};
+	}
+	Scintilla::ILexer5 *plex = Lexilla::MakeLexer(*language);
+	if (!plex) {
+		return {};
+	}
+	if (!SetProperties(plex, *language, propertyMap, path)) {
+		plex->Release();
+		return {};
+	}
+
+	std::string example = ReadFile(path);
+	if (example.starts_with(BOM)) {
+		example.erase(0, BOM.length());
+	}
+
+	BenchmarkResult result;
+	result.file = relativePath.generic_string();
+	result.lexer = *language;
+
+	TestDocument doc;
+	doc.Set(SynthesiseText(example, options.size));
+	Scintilla::IDocument *pdoc = &doc;
+	result.length = pdoc->Length();
+
+	double lexSeconds = 0.0;
+	double foldSeconds = 0.0;
+	for (int repeat = 0; repeat < benchmarkRepeats; repeat++) {
+		const size_t allocationsStart = allocationCount;
+		const Stopwatch swLex;
+		plex->Lex(0, pdoc->Length(), 0, pdoc);
+		const double lexNow = swLex.Seconds();
+		const size_t allocationsLexed = allocationCount;
+		const Stopwatch swFold;
+		plex->Fold(0, pdoc->Length(), 0, pdoc);
+		const double foldNow = swFold.Seconds();
+		if (repeat == 0 || lexNow < lexSeconds) {
+			lexSeconds = lexNow;
+		}
+		if (repeat == 0 || foldNow < foldSeconds) {
+			foldSeconds = foldNow;
+		}
+		result.allocationsLex = allocationsLexed - allocationsStart;
+		result.allocationsFold = allocationCount - allocationsLexed;
+	}
+	result.lexMBPerSecond = MBPerSecond(result.length, lexSeconds);
+	result.foldMBPerSecond = MBPerSecond(result.length, foldSeconds);
+
+	// Insert single characters at random positions then restyle from the start of the
+	// edited line as an editor does before redrawing.
+	std::mt19937 generator(options.seed);
+	std::uniform_int_distribution<size_t> positionDistribution(0, result.length ? result.length - 1 : 0);
+	std::uniform_int_distribution<size_t> characterDistribution(0, editCharacters.length() - 1);
+	double editSeconds = 0.0;
+	size_t allocationsEdits = 0;
+	for (int edit = 0; (edit < options.edits) && (result.length > 0); edit++) {
+		Sci_Position position = positionDistribution(generator);
+		char ch = '\0';
+		// Only insert before ASCII so edits do not split multi-byte characters
+		while (position < pdoc->Length()) {
+			pdoc->GetCharRange(&ch, position, 1);
+			if (static_cast<unsigned char>(ch) < 0x80) {
+				break;
+			}
+			position++;
+		}
+		doc.Insert(position, editCharacters.substr(characterDistribution(generator), 1));
+		const Sci_Position line = pdoc->LineFromPosition(position);
+		const Sci_Position startLine = pdoc->LineStart(line);
+		const Sci_Position endLine = pdoc->LineStart(line + benchmarkScreenLines);
+		const int styleStart = (startLine > 0) ? pdoc->StyleAt(startLine - 1) : 0;
+		const size_t allocationsStart = allocationCount;
+		const Stopwatch swEdit;
+		plex->Lex(startLine, endLine - startLine, styleStart, pdoc);
+		plex->Fold(startLine, endLine - startLine, styleStart, pdoc);
+		const double editNow = swEdit.Seconds();
+		allocationsEdits += allocationCount - allocationsStart;
+		editSeconds += editNow;
+		result.editMicrosecondsMax = std::max(result.editMicrosecondsMax, editNow * 1.0e6);
+	}
+	if (options.edits > 0) {
+		result.editMicroseconds = editSeconds * 1.0e6 / options.edits;
+		result.allocationsEdit = static_cast<double>(allocationsEdits) / options.edits;
+	}
+
+	plex->Release();
+	return result;
+}
+
+void BenchmarkDirectory(std::filesystem::path directory, std::filesystem::path basePath,
+	const BenchmarkOptions &options, std::vector<BenchmarkResult> &results) {
+	for (auto &p : std::filesystem::directory_iterator(directory)) {
+		if (!p.is_directory()) {
+			const std::string extension = p.path().extension().string();
+			if (extension != ".properties" && extension != suffixStyled && extension != ".new" &&
+				extension != suffixFolded) {
+				const std::filesystem::path relativePath = p.path().lexically_relative(basePath);
+				PropertyMap properties;
+				properties.properties["FileNameExt"] = p.path().filename().string();
+				properties.ReadFromFile(directory / "SciTE.properties");
+				std::optional<BenchmarkResult> result = BenchmarkFile(p, relativePath, properties, options);
+				if (result) {
+					std::cout << std::left << std::setw(48) << result->file << std::right << std::fixed <<
+						std::setprecision(1) <<
+						" lex " << std::setw(8) << result->lexMBPerSecond << " MB/s" <<
+						" fold " << std::setw(8) << result->foldMBPerSecond << " MB/s" <<
+						" edit " << std::setw(8) << result->editMicroseconds << " us";
+					if (countAllocations) {
+						std::cout << " allocations " << result->allocationsLex << "/" << result->allocationsFold;
+					}
+					std::cout << "\n";
+					results.push_back(*result);
+				}
+			}
+		}
+	}
+}
+
+std::string JSONString(std::string_view sv) {
+	std::string quoted = "\"";
+	for (const char ch : sv) {
+		if (ch == '"' || ch == '\\') {
+			quoted.push_back('\\');
+		}
+		quoted.push_back(ch);
+	}
+	quoted.push_back('"');
+	return quoted;
+}
+
+void WriteBenchmarkReport(std::ostream &os, const BenchmarkOptions &options, const std::vector<BenchmarkResult> &results) {
+	os << "{\n";
+	os << "  \"size\": " << options.size << ",\n";
+	os << "  \"edits\": " << options.edits << ",\n";
+	os << "  \"seed\": " << options.seed << ",\n";
+	os << "  \"results\": [\n";
+	os << std::fixed << std::setprecision(3);
+	for (size_t i = 0; i < results.size(); i++) {
+		const BenchmarkResult &result = results[i];
+		os << "    {" <<
+			"\"file\": " << JSONString(result.file) << ", " <<
+			"\"lexer\": " << JSONString(result.lexer) << ", " <<
+			"\"length\": " << result.length << ", " <<
+			"\"lexMBPerSecond\": " << result.lexMBPerSecond << ", " <<
+			"\"foldMBPerSecond\": " << result.foldMBPerSecond << ", " <<
+			"\"editMicroseconds\": " << result.editMicroseconds << ", " <<
+			"\"editMicrosecondsMax\": " << result.editMicrosecondsMax;
+		if (countAllocations) {
+			os << ", " <<
+				"\"allocationsLex\": " << result.allocationsLex << ", " <<
+				"\"allocationsFold\": " << result.allocationsFold << ", " <<
+				"\"allocationsEdit\": " << result.allocationsEdit;
+		}
+		os << "}" << ((i + 1 < results.size()) ? "," : "") << "\n";
+	}
+	os << "  ]\n";
+	os << "}\n";
+}
+
+bool BenchmarkLexilla(std::filesystem::path basePath, const BenchmarkOptions &options) {
+	if (!std::filesystem::exists(basePath)) {
+		std::cout << "No examples at " << basePath.string() << "\n";
+		return false;
+	}
+
+	std::vector<BenchmarkResult> results;
+	for (auto &p : std::filesystem::recursive_directory_iterator(basePath)) {
+		if (p.is_directory()) {
+			BenchmarkDirectory(p, basePath, options, results);
+		}
+	}
+
+	std::ofstream ofs(options.report);
+	if (!ofs) {
+		std::cout << "Can not write benchmark report " << options.report.string() << "\n";
+		return false;
+	}
+	WriteBenchmarkReport(ofs, options, results);
+	std::cout << "Benchmark report written to " << options.report.string() << "\n";
+	return true;
+}
+
 std::filesystem::path FindLexillaDirectory(std::filesystem::path startDirectory) {
 	// Search up from startDirectory for a directory named "lexilla" or containing a "bin" subdirectory
 	std::filesystem::path directory = startDirectory;
@@ -991,11 +1283,30 @@ int main(int argc, char **argv) {
     bool success = false;
     const std::filesystem::path baseDirectory = FindLexillaDirectory(std::filesystem::current_path());
     std::filesystem::path examplesDirectory = baseDirectory / "test" / "examples";
+    bool benchmark = false;
+    BenchmarkOptions options;
     for (int i = 1; i < argc; i++) {
-      if (argv[i][0] != '-') {
+      const std::string_view arg = argv[i];
+      if (arg[0] != '-') {
 				examplesDirectory = argv[i];
+			} else if (arg == "--benchmark") {
+				benchmark = true;
+			} else if (arg.starts_with("--benchmark-size=")) {
+				options.size = std::strtoul(argv[i] + arg.find('=') + 1, nullptr, 10) * 1024 * 1024;
+			} else if (arg.starts_with("--benchmark-edits=")) {
+				options.edits = std::atoi(argv[i] + arg.find('=') + 1);
+			} else if (arg.starts_with("--benchmark-seed=")) {
+				options.seed = static_cast<unsigned int>(std::strtoul(argv[i] + arg.find('=') + 1, nullptr, 10));
+			} else if (arg.starts_with("--benchmark-lexer=")) {
+				options.lexer = arg.substr(arg.find('=') + 1);
+			} else if (arg.starts_with("--benchmark-report=")) {
+				options.report = arg.substr(arg.find('=') + 1);
 			}
     }
-    success = AccessLexilla(examplesDirectory);
+    if (benchmark) {
+      success = BenchmarkLexilla(examplesDirectory, options);
+    } else {
+      success = AccessLexilla(examplesDirectory);
+    }
     return success ? 0 : 1;
 }
@@ -0,0 +1,98 @@
+/** @file testCharacterCategory.cxx
+ ** Unit Tests for Lexilla internal data structures
+ **/
+
+#include <cstddef>
+
+#include <vector>
+
+#include "CharacterCategory.h"
+
+#include "catch.hpp"
+
+using namespace Lexilla;
+
+// Test CharacterCategory.
+
+TEST_CASE("CharacterCategory") {
+
+	SECTION("All") {
+		REQUIRE(CategoriseCharacter('A') == ccLu);
+		REQUIRE(CategoriseCharacter('a') == ccLl);
+		REQUIRE(CategoriseCharacter(0x01C5) == ccLt);
+		REQUIRE(CategoriseCharacter(0x0E46) == ccLm);
+		REQUIRE(CategoriseCharacter(0x4E00) == ccLo);
+
+		REQUIRE(CategoriseCharacter(0x0300) == ccMn);
+		REQUIRE(CategoriseCharacter(0x0903) == ccMc);
+		REQUIRE(CategoriseCharacter(0x20E0) == ccMe);
+
+		REQUIRE(CategoriseCharacter('7') == ccNd);
+		REQUIRE(CategoriseCharacter(0x2160) == ccNl);
+		REQUIRE(CategoriseCharacter(0x00BC) == ccNo);
+
+		REQUIRE(CategoriseCharacter('_') == ccPc);
+		REQUIRE(CategoriseCharacter('-') == ccPd);
+		REQUIRE(CategoriseCharacter('(') == ccPs);
+		REQUIRE(CategoriseCharacter('}') == ccPe);
+		REQUIRE(CategoriseCharacter(0x00AB) == ccPi);
+		REQUIRE(CategoriseCharacter(0x00BB) == ccPf);
+		REQUIRE(CategoriseCharacter('"') == ccPo);
+
+		REQUIRE(CategoriseCharacter('+') == ccSm);
+		REQUIRE(CategoriseCharacter('$') == ccSc);
+		REQUIRE(CategoriseCharacter(0x02C2) == ccSk);
+		REQUIRE(CategoriseCharacter(0x00A6) == ccSo);
+
+		REQUIRE(CategoriseCharacter(' ') == ccZs);
+		REQUIRE(CategoriseCharacter(0x2028) == ccZl);
+		REQUIRE(CategoriseCharacter(0x2029) == ccZp);
+
+		REQUIRE(CategoriseCharacter('\n') == ccCc);
+		REQUIRE(CategoriseCharacter(0x00AD) == ccCf);
+		REQUIRE(CategoriseCharacter(0xD800) == ccCs);
+		REQUIRE(CategoriseCharacter(0xE000) == ccCo);
+		REQUIRE(CategoriseCharacter(0xFFFE) == ccCn);
+	}
+
+	SECTION("Limits") {
+		REQUIRE(CategoriseCharacter(-1) == ccCn);
+		REQUIRE(CategoriseCharacter(0) == ccCc);
+		REQUIRE(CategoriseCharacter(0x1F600) == ccSo);
+		REQUIRE(CategoriseCharacter(0x20000) == ccLo);
+		REQUIRE(CategoriseCharacter(0x10FFFD) == ccCo);
+		REQUIRE(CategoriseCharacter(0x10FFFF) == ccCn);
+		REQUIRE(CategoriseCharacter(0x110000) == ccCn);
+	}
+
+	SECTION("Map") {
+		CharacterCategoryMap ccm;
+		REQUIRE(ccm.Size() == 256);
+		ccm.Optimize(0x10000);
+		REQUIRE(ccm.Size() == 0x10000);
+		for (int character = 0; character < 0x11000; character++) {
+			REQUIRE(ccm.CategoryFor(character) == CategoriseCharacter(character));
+		}
+	}
+
+	SECTION("Identifiers") {
+		REQUIRE(IsXidStart('a'));
+		REQUIRE(!IsXidStart('1'));
+		REQUIRE(IsXidContinue('1'));
+		REQUIRE(IsXidStart(0x4E00));
+		// Other_ID_Start and Other_ID_Continue
+		REQUIRE(IsIdStart(0x2118));
+		REQUIRE(!IsIdStart(0x00B7));
+		REQUIRE(IsIdContinue(0x00B7));
+		// Pattern_Syntax
+		REQUIRE(!IsIdStart(0x2E2F));
+		REQUIRE(!IsIdContinue(0x2E2F));
+		// Removed for Normalization Form KC
+		REQUIRE(IsIdStart(0x037A));
+		REQUIRE(!IsXidStart(0x037A));
+		REQUIRE(!IsXidContinue(0x037A));
+		REQUIRE(IsXidContinue(0x0E33));
+		REQUIRE(!IsXidStart(0x0E33));
+	}
+
+}
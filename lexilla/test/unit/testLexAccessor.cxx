@@ -0,0 +1,180 @@
+/** @file testLexAccessor.cxx
+ ** Unit Tests for Lexilla internal data structures
+ **/
+
+#include <cassert>
+#include <cstring>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ILexer.h"
+
+#include "LexAccessor.h"
+
+#include "catch.hpp"
+
+using namespace Lexilla;
+
+// Test LexAccessor.
+
+namespace {
+
+// Single line document which may lend its text either side of a pretend gap.
+class RangeDocument : public Scintilla::IDocumentRange {
+	std::string text;
+	std::string previous;
+	Sci_Position gap;
+	int version;
+	void MoveGap() {
+		// Act like a notification handler that moves the gap: the text moves to new memory
+		// and the old memory is overwritten so stale pointers read '#'.
+		previous = text;
+		previous.swap(text);
+		std::fill(previous.begin(), previous.end(), '#');
+		gap = (gap + 997) % (Length() + 1);
+	}
+public:
+	std::string styles;
+	Sci_Position endStyled = 0;
+	int styleCalls = 0;
+	bool moveGapOnStyle = false;
+	RangeDocument(std::string_view text_, Sci_Position gap_, int version_) :
+		text(text_), gap(gap_), version(version_), styles(text_.length(), '\0') {
+	}
+	int SCI_METHOD Version() const override { return version; }
+	void SCI_METHOD SetErrorStatus(int) override {}
+	Sci_Position SCI_METHOD Length() const override { return text.length(); }
+	void SCI_METHOD GetCharRange(char *buffer, Sci_Position position, Sci_Position lengthRetrieve) const override {
+		memcpy(buffer, text.data() + position, lengthRetrieve);
+	}
+	char SCI_METHOD StyleAt(Sci_Position position) const override { return styles.at(position); }
+	Sci_Position SCI_METHOD LineFromPosition(Sci_Position) const override { return 0; }
+	Sci_Position SCI_METHOD LineStart(Sci_Position line) const override { return (line <= 0) ? 0 : Length(); }
+	int SCI_METHOD GetLevel(Sci_Position) const override { return 0; }
+	int SCI_METHOD SetLevel(Sci_Position, int) override { return 0; }
+	int SCI_METHOD GetLineState(Sci_Position) const override { return 0; }
+	int SCI_METHOD SetLineState(Sci_Position, int) override { return 0; }
+	void SCI_METHOD StartStyling(Sci_Position position) override { endStyled = position; }
+	bool SCI_METHOD SetStyleFor(Sci_Position length, char style) override {
+		styleCalls++;
+		for (Sci_Position i = 0; i < length; i++)
+			styles.at(endStyled++) = style;
+		if (moveGapOnStyle)
+			MoveGap();
+		return true;
+	}
+	bool SCI_METHOD SetStyles(Sci_Position length, const char *styles_) override {
+		styleCalls++;
+		for (Sci_Position i = 0; i < length; i++)
+			styles.at(endStyled++) = styles_[i];
+		if (moveGapOnStyle)
+			MoveGap();
+		return true;
+	}
+	void SCI_METHOD DecorationSetCurrentIndicator(int) override {}
+	void SCI_METHOD DecorationFillRange(Sci_Position, int, Sci_Position) override {}
+	void SCI_METHOD ChangeLexerState(Sci_Position, Sci_Position) override {}
+	int SCI_METHOD CodePage() const override { return 0; }
+	bool SCI_METHOD IsDBCSLeadByte(char) const override { return false; }
+	const char *SCI_METHOD BufferPointer() override { return text.c_str(); }
+	int SCI_METHOD GetLineIndentation(Sci_Position) override { return 0; }
+	Sci_Position SCI_METHOD LineEnd(Sci_Position) const override { return Length(); }
+	Sci_Position SCI_METHOD GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const override {
+		return positionStart + characterOffset;
+	}
+	int SCI_METHOD GetCharacterAndWidth(Sci_Position position, Sci_Position *pWidth) const override {
+		if (pWidth)
+			*pWidth = 1;
+		return static_cast<unsigned char>(text.at(position));
+	}
+	Sci_Position SCI_METHOD GapPosition() const override { return gap; }
+	const char *SCI_METHOD RangePointer(Sci_Position position, Sci_Position rangeLength) override {
+		REQUIRE(((position + rangeLength <= gap) || (position >= gap)));
+		return text.c_str() + position;
+	}
+};
+
+std::string Pattern(size_t length) {
+	std::string s;
+	for (size_t i = 0; i < length; i++)
+		s.push_back(static_cast<char>('a' + (i * 7) % 26));
+	return s;
+}
+
+void CheckReading(RangeDocument &doc, std::string_view expected) {
+	LexAccessor styler(&doc);
+	const Sci_Position length = expected.length();
+	// Forwards, backwards and jumping across the document
+	for (Sci_Position pos = 0; pos < length; pos++)
+		REQUIRE(styler[pos] == expected[pos]);
+	for (Sci_Position pos = length - 1; pos >= 0; pos--)
+		REQUIRE(styler.SafeGetCharAt(pos) == expected[pos]);
+	for (Sci_Position pos = 0; pos < length; pos += 397)
+		REQUIRE(styler[length - 1 - pos] == expected[length - 1 - pos]);
+	REQUIRE(styler.SafeGetCharAt(-1, '!') == '!');
+	REQUIRE(styler.SafeGetCharAt(length, '!') == '!');
+	for (Sci_Position pos = 0; pos + 50 < length; pos += 233)
+		REQUIRE(styler.GetRange(pos, pos + 50) == expected.substr(pos, 50));
+}
+
+}
+
+TEST_CASE("LexAccessor") {
+
+	// Several windows long so copying reads refill
+	const Sci_Position size = LexAccessor::BufferSize() * 3;
+	const std::string text = Pattern(size);
+
+	SECTION("Window") {
+		RangeDocument doc(text, size / 3, Scintilla::dvRelease4);
+		CheckReading(doc, text);
+	}
+
+	SECTION("Borrowed") {
+		for (const Sci_Position gap : { Sci_Position(0), Sci_Position(1), size / 3, size - 1, size }) {
+			RangeDocument doc(text, gap, Scintilla::dvRelease5);
+			CheckReading(doc, text);
+		}
+	}
+
+	SECTION("Styles") {
+		RangeDocument doc(text, size / 3, Scintilla::dvRelease5);
+		LexAccessor styler(&doc);
+		const Sci_PositionU split = size * 2 / 3;
+		styler.StartAt(0);
+		styler.StartSegment(0);
+		for (Sci_PositionU pos = 9; pos < split; pos += 10)
+			styler.ColourTo(pos, static_cast<int>(pos / 10 % 7));
+		// Longer than the style buffer
+		styler.ColourTo(size - 1, 9);
+		styler.Flush();
+		for (Sci_PositionU pos = 0; pos < split; pos++)
+			REQUIRE(doc.styles[pos] == static_cast<char>(pos / 10 % 7));
+		for (Sci_Position pos = split; pos < size; pos++)
+			REQUIRE(doc.styles[pos] == 9);
+		// Styles are sent in buffer sized chunks
+		REQUIRE(doc.styleCalls <= 4);
+	}
+
+	SECTION("GapMovedByStyling") {
+		// Text read after styles are sent comes from where the document holds it now
+		RangeDocument doc(text, size / 3, Scintilla::dvRelease5);
+		doc.moveGapOnStyle = true;
+		LexAccessor styler(&doc);
+		styler.StartAt(0);
+		styler.StartSegment(0);
+		for (Sci_Position pos = 0; pos < size; pos++) {
+			REQUIRE(styler[pos] == text[pos]);
+			styler.ColourTo(pos, 1);
+			if (pos % 1000 == 999) {
+				styler.Flush();
+				REQUIRE(styler[pos] == text[pos]);
+			}
+		}
+		styler.Flush();
+		REQUIRE(doc.styleCalls > 3);
+	}
+}
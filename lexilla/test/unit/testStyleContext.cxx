@@ -0,0 +1,159 @@
+/** @file testStyleContext.cxx
+ ** Unit Tests for Lexilla internal data structures
+ **/
+
+#include <cstdint>
+#include <cstring>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ILexer.h"
+
+#include "LexAccessor.h"
+#include "StyleContext.h"
+
+#include "catch.hpp"
+
+using namespace Lexilla;
+
+// Test StyleContext.
+
+namespace {
+
+// Single line UTF-8 document that reports invalid bytes as Scintilla's Document does.
+class UTF8Document : public Scintilla::IDocument {
+	std::string text;
+	std::vector<char> styles;
+	Sci_Position endStyled = 0;
+public:
+	explicit UTF8Document(std::string_view text_) : text(text_), styles(text_.length()) {
+	}
+	int SCI_METHOD Version() const override { return Scintilla::dvRelease4; }
+	void SCI_METHOD SetErrorStatus(int) override {}
+	Sci_Position SCI_METHOD Length() const override { return text.length(); }
+	void SCI_METHOD GetCharRange(char *buffer, Sci_Position position, Sci_Position lengthRetrieve) const override {
+		memcpy(buffer, text.data() + position, lengthRetrieve);
+	}
+	char SCI_METHOD StyleAt(Sci_Position position) const override { return styles.at(position); }
+	Sci_Position SCI_METHOD LineFromPosition(Sci_Position) const override { return 0; }
+	Sci_Position SCI_METHOD LineStart(Sci_Position line) const override { return (line <= 0) ? 0 : Length(); }
+	int SCI_METHOD GetLevel(Sci_Position) const override { return 0; }
+	int SCI_METHOD SetLevel(Sci_Position, int) override { return 0; }
+	int SCI_METHOD GetLineState(Sci_Position) const override { return 0; }
+	int SCI_METHOD SetLineState(Sci_Position, int) override { return 0; }
+	void SCI_METHOD StartStyling(Sci_Position position) override { endStyled = position; }
+	bool SCI_METHOD SetStyleFor(Sci_Position length, char style) override {
+		for (Sci_Position i = 0; i < length; i++)
+			styles.at(endStyled++) = style;
+		return true;
+	}
+	bool SCI_METHOD SetStyles(Sci_Position length, const char *styles_) override {
+		for (Sci_Position i = 0; i < length; i++)
+			styles.at(endStyled++) = styles_[i];
+		return true;
+	}
+	void SCI_METHOD DecorationSetCurrentIndicator(int) override {}
+	void SCI_METHOD DecorationFillRange(Sci_Position, int, Sci_Position) override {}
+	void SCI_METHOD ChangeLexerState(Sci_Position, Sci_Position) override {}
+	int SCI_METHOD CodePage() const override { return 65001; }
+	bool SCI_METHOD IsDBCSLeadByte(char) const override { return false; }
+	const char *SCI_METHOD BufferPointer() override { return text.c_str(); }
+	int SCI_METHOD GetLineIndentation(Sci_Position) override { return 0; }
+	Sci_Position SCI_METHOD LineEnd(Sci_Position) const override { return Length(); }
+	Sci_Position SCI_METHOD GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const override {
+		Sci_Position pos = positionStart;
+		while (characterOffset > 0) {
+			Sci_Position width = 1;
+			GetCharacterAndWidth(pos, &width);
+			pos += width;
+			characterOffset--;
+		}
+		while (characterOffset < 0) {
+			if (pos <= 0)
+				return -1;
+			// Step back over the longest valid character ending just before pos
+			Sci_Position back = 1;
+			for (Sci_Position width = 2; width <= 4 && pos - width >= 0; width++) {
+				Sci_Position widthFound = 1;
+				GetCharacterAndWidth(pos - width, &widthFound);
+				if (widthFound == width)
+					back = width;
+			}
+			pos -= back;
+			characterOffset++;
+		}
+		return pos;
+	}
+	int SCI_METHOD GetCharacterAndWidth(Sci_Position position, Sci_Position *pWidth) const override {
+		if (pWidth)
+			*pWidth = 1;
+		if ((position < 0) || (position >= Length()))
+			return 0;
+		const unsigned char lead = text[position];
+		if (lead < 0x80)
+			return lead;
+		const int width = (lead >= 0xF0) ? 4 : ((lead >= 0xE0) ? 3 : ((lead >= 0xC0) ? 2 : 1));
+		int character = lead & (0x7F >> width);
+		for (int b = 1; b < width; b++) {
+			const unsigned char trail = (position + b < Length()) ? text[position + b] : 0;
+			if ((width == 1) || ((trail & 0xC0) != 0x80))
+				return 0xDC80 + lead;
+			character = (character << 6) | (trail & 0x3F);
+		}
+		constexpr int minimum[] = { 0, 0, 0x80, 0x800, 0x10000 };
+		if ((width == 1) || (character < minimum[width]) || (character > 0x10FFFF) ||
+			((character >= 0xD800) && (character <= 0xDFFF)) ||
+			((character >= 0xFDD0) && (character <= 0xFDEF)) || ((character & 0xFFFE) == 0xFFFE))
+			return 0xDC80 + lead;
+		if (pWidth)
+			*pWidth = width;
+		return character;
+	}
+};
+
+// Mixes ASCII with 2, 3 and 4 byte characters and invalid, overlong, surrogate, non-character and truncated sequences.
+const std::string_view mixed =
+	"ab\xC3\xA9" "c\xE2\x82\xAC" "d\xF0\x9F\x98\x80" "e\x80" "f\xC0\xAF" "g\xED\xA0\x80" "h\xEF\xBF\xBE"
+	"i\xF4\x90\x80\x80" "j\xE0\x80\xAF" "k\xEF\xB7\x90" "l\xF5" "m\xE2\x82";
+
+}
+
+TEST_CASE("StyleContext") {
+
+	SECTION("ForwardUTF8") {
+		UTF8Document doc(mixed);
+		LexAccessor styler(&doc);
+		StyleContext sc(0, doc.Length(), 0, styler);
+		Sci_Position position = 0;
+		for (; sc.More(); sc.Forward()) {
+			REQUIRE(sc.currentPos == static_cast<Sci_PositionU>(position));
+			Sci_Position width = 0;
+			const int character = doc.GetCharacterAndWidth(position, &width);
+			REQUIRE(sc.ch == character);
+			REQUIRE(sc.width == width);
+			const int characterNext = doc.GetCharacterAndWidth(position + width, nullptr);
+			REQUIRE(sc.chNext == characterNext);
+			position += width;
+		}
+		// StyleContext visits one position past the end of the document
+		REQUIRE(position == doc.Length() + 1);
+		sc.Complete();
+	}
+
+	SECTION("GetRelativeCharacter") {
+		UTF8Document doc(mixed);
+		LexAccessor styler(&doc);
+		StyleContext sc(0, doc.Length(), 0, styler);
+		for (; sc.More(); sc.Forward()) {
+			for (Sci_Position n = -6; n <= 6; n++) {
+				const Sci_Position position = doc.GetRelativePosition(sc.currentPos, n);
+				const int expected = doc.GetCharacterAndWidth(position, nullptr);
+				REQUIRE(sc.GetRelativeCharacter(n) == expected);
+			}
+		}
+		sc.Complete();
+	}
+
+}
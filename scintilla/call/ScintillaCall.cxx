@@ -335,6 +335,14 @@ void ScintillaCall::SetBufferedDraw(bool buffered) {
 	Call(Message::SetBufferedDraw, buffered);
 }
 
+void ScintillaCall::SetLineRasterCache(bool cache) {
+	Call(Message::SetLineRasterCache, cache);
+}
+
+bool ScintillaCall::LineRasterCache() {
+	return Call(Message::GetLineRasterCache);
+}
+
 void ScintillaCall::SetTabWidth(int tabWidth) {
 	Call(Message::SetTabWidth, tabWidth);
 }
@@ -859,6 +867,18 @@ std::string ScintillaCall::UndoActionText(int action) {
 	return CallReturnString(Message::GetUndoActionText, action);
 }
 
+void ScintillaCall::SetUndoMemoryLimit(Position bytes) {
+	Call(Message::SetUndoMemoryLimit, bytes);
+}
+
+Position ScintillaCall::UndoMemoryLimit() {
+	return Call(Message::GetUndoMemoryLimit);
+}
+
+Position ScintillaCall::UndoMemory() {
+	return Call(Message::GetUndoMemory);
+}
+
 void ScintillaCall::IndicSetStyle(int indicator, Scintilla::IndicatorStyle indicatorStyle) {
 	Call(Message::IndicSetStyle, indicator, static_cast<intptr_t>(indicatorStyle));
 }
@@ -2675,6 +2695,10 @@ void ScintillaCall::IndicatorClearRange(Position start, Position lengthClear) {
 	Call(Message::IndicatorClearRange, start, lengthClear);
 }
 
+void ScintillaCall::IndicatorFillRanges(Position count, IndicatorFill *fills) {
+	CallPointer(Message::IndicatorFillRanges, count, fills);
+}
+
 int ScintillaCall::IndicatorAllOnFor(Position pos) {
 	return static_cast<int>(Call(Message::IndicatorAllOnFor, pos));
 }
@@ -2707,6 +2731,14 @@ int ScintillaCall::LayoutThreads() {
 	return static_cast<int>(Call(Message::GetLayoutThreads));
 }
 
+Position ScintillaCall::ProfileCounter(Scintilla::ProfileCounter counter) {
+	return Call(Message::GetProfileCounter, static_cast<uintptr_t>(counter));
+}
+
+void ScintillaCall::ResetProfileCounters() {
+	Call(Message::ResetProfileCounters);
+}
+
 void ScintillaCall::CopyAllowLine() {
 	Call(Message::CopyAllowLine);
 }
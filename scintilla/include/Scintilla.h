@@ -96,6 +96,8 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_SETSTYLING 2033
 #define SCI_GETBUFFEREDDRAW 2034
 #define SCI_SETBUFFEREDDRAW 2035
+#define SCI_SETLINERASTERCACHE 2813
+#define SCI_GETLINERASTERCACHE 2814
 #define SCI_SETTABWIDTH 2036
 #define SCI_GETTABWIDTH 2121
 #define SCI_SETTABMINIMUMWIDTH 2724
@@ -354,6 +356,9 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_GETUNDOACTIONTYPE 2802
 #define SCI_GETUNDOACTIONPOSITION 2803
 #define SCI_GETUNDOACTIONTEXT 2804
+#define SCI_SETUNDOMEMORYLIMIT 2805
+#define SCI_GETUNDOMEMORYLIMIT 2806
+#define SCI_GETUNDOMEMORY 2807
 #define INDIC_PLAIN 0
 #define INDIC_SQUIGGLE 1
 #define INDIC_TT 2
@@ -447,6 +452,7 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SC_AUTOCOMPLETE_NORMAL 0
 #define SC_AUTOCOMPLETE_FIXED_SIZE 1
 #define SC_AUTOCOMPLETE_SELECT_FIRST_ITEM 2
+#define SC_AUTOCOMPLETE_FUZZY 4
 #define SCI_AUTOCSETOPTIONS 2638
 #define SCI_AUTOCGETOPTIONS 2639
 #define SCI_AUTOCSETDROPRESTOFWORD 2270
@@ -966,6 +972,7 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_GETINDICATORVALUE 2503
 #define SCI_INDICATORFILLRANGE 2504
 #define SCI_INDICATORCLEARRANGE 2505
+#define SCI_INDICATORFILLRANGES 2808
 #define SCI_INDICATORALLONFOR 2506
 #define SCI_INDICATORVALUEAT 2507
 #define SCI_INDICATORSTART 2508
@@ -974,6 +981,17 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_GETPOSITIONCACHE 2515
 #define SCI_SETLAYOUTTHREADS 2775
 #define SCI_GETLAYOUTTHREADS 2776
+#define SC_PROFILE_PAINTS 0
+#define SC_PROFILE_PAINT_TIME 1
+#define SC_PROFILE_LAYOUT_TIME 2
+#define SC_PROFILE_LINES_LAID_OUT 3
+#define SC_PROFILE_MEASURED_RUNS 4
+#define SC_PROFILE_POSITION_CACHE_HITS 5
+#define SC_PROFILE_STYLED_BYTES 6
+#define SC_PROFILE_WRAP_TIME 7
+#define SC_PROFILE_IDLE_TIME 8
+#define SCI_GETPROFILECOUNTER 2811
+#define SCI_RESETPROFILECOUNTERS 2812
 #define SCI_COPYALLOWLINE 2519
 #define SCI_CUTALLOWLINE 2810
 #define SCI_GETCHARACTERPOINTER 2520
@@ -1344,6 +1362,12 @@ struct SCINTILLA_EXPORT Sci_TextToFindFull {
   struct Sci_CharacterRangeFull chrgText;
 };
 
+struct SCINTILLA_EXPORT Sci_IndicatorFill {
+  Sci_Position position;
+  Sci_Position fillLength;
+  int value;
+};
+
 typedef void *Sci_SurfaceID;
 
 struct SCINTILLA_EXPORT Sci_Rectangle {
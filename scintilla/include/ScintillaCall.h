@@ -22,6 +22,7 @@ enum class Message; // Declare in case ScintillaMessages.h not included
 struct TextRangeFull;
 struct TextToFindFull;
 struct RangeToFormatFull;
+struct IndicatorFill;
 
 class IDocumentEditable;
 
@@ -127,6 +128,8 @@ public:
   void SetStyling(Position length, int style);
   bool BufferedDraw();
   void SetBufferedDraw(bool buffered);
+  void SetLineRasterCache(bool cache);
+  bool LineRasterCache();
   void SetTabWidth(int tabWidth);
   int TabWidth();
   void SetTabMinimumWidth(int pixels);
@@ -258,6 +261,9 @@ public:
   Position UndoActionPosition(int action);
   int UndoActionText(int action, char *text);
   std::string UndoActionText(int action);
+  void SetUndoMemoryLimit(Position bytes);
+  Position UndoMemoryLimit();
+  Position UndoMemory();
   void IndicSetStyle(int indicator, Scintilla::IndicatorStyle indicatorStyle);
   Scintilla::IndicatorStyle IndicGetStyle(int indicator);
   void IndicSetFore(int indicator, Colour fore);
@@ -712,6 +718,7 @@ public:
   int IndicatorValue();
   void IndicatorFillRange(Position start, Position lengthFill);
   void IndicatorClearRange(Position start, Position lengthClear);
+  void IndicatorFillRanges(Position count, IndicatorFill *fills);
   int IndicatorAllOnFor(Position pos);
   int IndicatorValueAt(int indicator, Position pos);
   Position IndicatorStart(int indicator, Position pos);
@@ -720,6 +727,8 @@ public:
   int PositionCache();
   void SetLayoutThreads(int threads);
   int LayoutThreads();
+  Position ProfileCounter(Scintilla::ProfileCounter counter);
+  void ResetProfileCounters();
   void CopyAllowLine();
   void CutAllowLine();
   void *CharacterPointer();
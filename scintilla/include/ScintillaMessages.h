@@ -57,6 +57,8 @@ enum class Message {
 	SetStyling = 2033,
 	GetBufferedDraw = 2034,
 	SetBufferedDraw = 2035,
+	SetLineRasterCache = 2813,
+	GetLineRasterCache = 2814,
 	SetTabWidth = 2036,
 	GetTabWidth = 2121,
 	SetTabMinimumWidth = 2724,
@@ -183,6 +185,9 @@ enum class Message {
 	GetUndoActionType = 2802,
 	GetUndoActionPosition = 2803,
 	GetUndoActionText = 2804,
+	SetUndoMemoryLimit = 2805,
+	GetUndoMemoryLimit = 2806,
+	GetUndoMemory = 2807,
 	IndicSetStyle = 2080,
 	IndicGetStyle = 2081,
 	IndicSetFore = 2082,
@@ -626,6 +631,7 @@ enum class Message {
 	GetIndicatorValue = 2503,
 	IndicatorFillRange = 2504,
 	IndicatorClearRange = 2505,
+	IndicatorFillRanges = 2808,
 	IndicatorAllOnFor = 2506,
 	IndicatorValueAt = 2507,
 	IndicatorStart = 2508,
@@ -634,6 +640,8 @@ enum class Message {
 	GetPositionCache = 2515,
 	SetLayoutThreads = 2775,
 	GetLayoutThreads = 2776,
+	GetProfileCounter = 2811,
+	ResetProfileCounters = 2812,
 	CopyAllowLine = 2519,
 	CutAllowLine = 2810,
 	GetCharacterPointer = 2520,
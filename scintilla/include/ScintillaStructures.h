@@ -47,6 +47,12 @@ struct SCINTILLA_EXPORT TextToFindFull {
 	CharacterRangeFull chrgText;
 };
 
+struct SCINTILLA_EXPORT IndicatorFill {
+  Position position;
+	Position fillLength;
+	int value;
+};
+
 using SurfaceID = void *;
 
 struct SCINTILLA_EXPORT Rectangle {
@@ -253,6 +253,7 @@ enum class AutoCompleteOption {
   Normal = 0,
   FixedSize = 1,
   SelectFirstItem = 2,
+  Fuzzy = 4,
 };
 
 enum class IndentView {
@@ -470,6 +471,18 @@ enum class CaretStyle {
   BlockAfter = 0x100,
 };
 
+enum class ProfileCounter {
+  Paints = 0,
+  PaintTime = 1,
+  LayoutTime = 2,
+  LinesLaidOut = 3,
+  MeasuredRuns = 4,
+  PositionCacheHits = 5,
+  StyledBytes = 6,
+  WrapTime = 7,
+  IdleTime = 8,
+};
+
 enum class MarginOption {
   None = 0,
   SubLineSelect = 1,
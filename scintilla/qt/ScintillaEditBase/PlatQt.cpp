@@ -12,9 +12,14 @@
 #include <QAction>
 #include <QApplication>
 #include <QColor>
+#include <QCoreApplication>
 #include <QFont>
+#include <QGlyphRun>
+#include <QAbstractListModel>
+#include <QIcon>
+#include <QImage>
 #include <QLibrary>
-#include <QListWidget>
+#include <QListView>
 #include <QMenu>
 #include <QMessageBox>
 #include <QPaintDevice>
@@ -28,10 +33,16 @@
 #include <QScrollBar>
 #include <QTextLayout>
 #include <QTextLine>
+#include <QThread>
 #include <QTime>
 #include <QVarLengthArray>
 #include <QWidget>
+#include <atomic>
 #include <cstdio>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include "CharacterType.h"
 #include "DBCS.h"
 #include "Debugging.h"
 #include "Platform.h"
@@ -85,8 +96,6 @@ const char *CharacterSetID(CharacterSet characterSet) {
   }
 }
 
-QString UnicodeFromText(QStringDecoder *decoder, std::string_view text) { return decoder->decode(text); }
-
 static QFont::StyleStrategy ChooseStrategy(FontQuality eff) {
   switch (eff) {
   case FontQuality::QualityDefault: return QFont::PreferDefault;
@@ -97,17 +106,35 @@ static QFont::StyleStrategy ChooseStrategy(FontQuality eff) {
   }
 }
 
+static uint64_t NextFontId() noexcept {
+  static std::atomic<uint64_t> fontId = 0;
+  return ++fontId;
+}
+
 class FontAndCharacterSet : public Font {
 public:
   CharacterSet characterSet = CharacterSet::Ansi;
   std::unique_ptr<QFont> pfont;
-  explicit FontAndCharacterSet(const FontParameters &fp) : characterSet(fp.characterSet) {
-    pfont = std::make_unique<QFont>();
-    pfont->setStyleStrategy(ChooseStrategy(fp.extraFontFlag));
-    pfont->setFamily(QString::fromUtf8(fp.faceName));
-    pfont->setPointSizeF(fp.size);
-    pfont->setBold(static_cast<int>(fp.weight) > 500);
-    pfont->setItalic(fp.italic);
+  // The request is kept so that layout worker threads can create their own QFont
+  const uint64_t id;
+  const QString family;
+  const qreal size;
+  const bool bold;
+  const bool italic;
+  const QFont::StyleStrategy strategy;
+  explicit FontAndCharacterSet(const FontParameters &fp)
+      : characterSet(fp.characterSet), id(NextFontId()), family(QString::fromUtf8(fp.faceName)), size(fp.size),
+        bold(static_cast<int>(fp.weight) > 500), italic(fp.italic), strategy(ChooseStrategy(fp.extraFontFlag)) {
+    pfont = std::make_unique<QFont>(Create());
+  }
+  QFont Create() const {
+    QFont font;
+    font.setStyleStrategy(strategy);
+    font.setFamily(family);
+    font.setPointSizeF(size);
+    font.setBold(bold);
+    font.setItalic(italic);
+    return font;
   }
 };
 
@@ -118,12 +145,170 @@ const Supports SupportsQt[] = {
     Supports::FractionalStrokeWidth,
     Supports::TranslucentStroke,
     Supports::PixelModification,
+#ifdef PLAT_QT_QML
+    // Worker threads measure without a paint device so only use reentrant font and layout
+    // classes. Only claimed by surfaces that measure the same as no device.
+    Supports::ThreadSafeMeasureWidths,
+#endif
 };
 
-const FontAndCharacterSet *AsFontAndCharacterSet(const Font *f) { return dynamic_cast<const FontAndCharacterSet *>(f); }
+// Font::Allocate only creates FontAndCharacterSet objects so no run-time check is needed
+const FontAndCharacterSet *AsFontAndCharacterSet(const Font *f) noexcept {
+  return static_cast<const FontAndCharacterSet *>(f);
+}
 
 QFont *FontPointer(const Font *f) { return AsFontAndCharacterSet(f)->pfont.get(); }
 
+const char *CodecName(const FontAndCharacterSet *pfacs, int codePage) {
+  return (codePage == SC_CP_UTF8) ? "UTF-8" : CharacterSetID(pfacs->characterSet);
+}
+
+bool OnMainThread() {
+  const QCoreApplication *app = QCoreApplication::instance();
+  return !app || (QThread::currentThread() == app->thread());
+}
+
+// Layout worker threads measure without a paint device which uses the default resolution so
+// their widths only match the main thread's when the surface's device has that resolution.
+bool MeasuresAsDefaultDevice(const QPaintDevice *device) {
+  if (!device) {
+    return true;
+  }
+  static const QImage defaultDevice(1, 1, QImage::Format_ARGB32_Premultiplied);
+  return (device->logicalDpiX() == defaultDevice.logicalDpiX()) &&
+         (device->logicalDpiY() == defaultDevice.logicalDpiY());
+}
+
+// Each thread has its own font engine cache and a QFont remembers the engine of the last thread
+// that used it, so threads sharing a QFont keep replacing each other's engine under a global lock.
+// Layout worker threads measure with their own copies of the fonts instead.
+const QFont &ThreadFont(const FontAndCharacterSet *pfacs) {
+  constexpr size_t maxThreadFonts = 100;
+  thread_local std::map<uint64_t, QFont> fonts;
+  auto it = fonts.find(pfacs->id);
+  if (it == fonts.end()) {
+    if (fonts.size() >= maxThreadFonts) {
+      fonts.clear();
+    }
+    it = fonts.emplace(pfacs->id, pfacs->Create()).first;
+  }
+  return it->second;
+}
+
+// Decoders are kept for each character set as styles with different character sets are often
+// drawn alternately. Decoders are not thread safe so each thread has its own. They are stateless
+// so a segment ending in a partial character, such as a DBCS lead byte, does not change the next segment.
+QStringDecoder &Decoder(const char *csid) {
+  thread_local std::map<const char *, QStringDecoder> decoders;
+  auto it = decoders.find(csid);
+  if (it == decoders.end()) {
+    it = decoders.emplace(csid, QStringDecoder(csid, QStringDecoder::Flag::Stateless)).first;
+  }
+  return it->second;
+}
+
+bool IsASCII(std::string_view text) noexcept {
+  return std::all_of(text.begin(), text.end(), [](char ch) noexcept { return UTF8IsAscii(ch); });
+}
+
+// Most text is ASCII which is the same in every supported encoding so needs no decoder
+QString DecodeText(const FontAndCharacterSet *pfacs, int codePage, std::string_view text) {
+  const qsizetype length = static_cast<qsizetype>(text.length());
+  if (IsASCII(text)) {
+    return QString::fromLatin1(text.data(), length);
+  }
+  if (codePage == SC_CP_UTF8) {
+    return QString::fromUtf8(text.data(), length);
+  }
+  return Decoder(CodecName(pfacs, codePage)).decode(text);
+}
+
+// Glyph positions depend on the resolution of the device the text was laid out for.
+struct GlyphRunDevice {
+  int dpiX = 0;
+  int dpiY = 0;
+  qreal pixelRatio = 1.0;
+  bool operator==(const GlyphRunDevice &other) const noexcept = default;
+};
+
+GlyphRunDevice DeviceForRuns(const QPaintDevice *device) {
+  if (!device) {
+    return {};
+  }
+  return {device->logicalDpiX(), device->logicalDpiY(), device->devicePixelRatioF()};
+}
+
+struct GlyphRunKey {
+  uint64_t fontId = 0;
+  int codePage = 0;
+  GlyphRunDevice device;
+  std::string_view text;
+};
+
+// Shaping is much of the cost of drawing text and the same text is drawn on every paint, so the
+// glyph runs from laying out text are kept for drawing it. Glyph runs hold fonts that belong to
+// the thread that shaped them so this is only used on the main thread.
+class GlyphRunCache {
+  static constexpr size_t maxEntries = 4000;
+  struct StoredKey {
+    uint64_t fontId = 0;
+    int codePage = 0;
+    GlyphRunDevice device;
+    std::string text;
+    GlyphRunKey View() const noexcept { return {fontId, codePage, device, text}; }
+  };
+  // Transparent so that finding a segment does not copy its text
+  struct KeyHash {
+    using is_transparent = void;
+    size_t operator()(const GlyphRunKey &key) const noexcept {
+      size_t hash = std::hash<std::string_view>()(key.text);
+      hash ^= std::hash<uint64_t>()(key.fontId) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+      hash ^= std::hash<int>()(key.codePage + key.device.dpiX * 31 + key.device.dpiY) + (hash << 6) + (hash >> 2);
+      return hash;
+    }
+    size_t operator()(const StoredKey &key) const noexcept { return (*this)(key.View()); }
+  };
+  struct KeyEqual {
+    using is_transparent = void;
+    static bool Equal(const GlyphRunKey &a, const GlyphRunKey &b) noexcept {
+      return a.fontId == b.fontId && a.codePage == b.codePage && a.device == b.device && a.text == b.text;
+    }
+    bool operator()(const GlyphRunKey &a, const StoredKey &b) const noexcept { return Equal(a, b.View()); }
+    bool operator()(const StoredKey &a, const GlyphRunKey &b) const noexcept { return Equal(a.View(), b); }
+    bool operator()(const StoredKey &a, const StoredKey &b) const noexcept { return Equal(a.View(), b.View()); }
+  };
+  std::unordered_map<StoredKey, QList<QGlyphRun>, KeyHash, KeyEqual> runs;
+
+public:
+  const QList<QGlyphRun> *Find(const GlyphRunKey &key) {
+    const auto it = runs.find(key);
+    return (it == runs.end()) ? nullptr : &it->second;
+  }
+  const QList<QGlyphRun> &Add(const GlyphRunKey &key, const QTextLayout &layout) {
+    if (runs.size() >= maxEntries) {
+      runs.clear();
+    }
+    QList<QGlyphRun> glyphRuns = layout.glyphRuns();
+    // Glyph positions are relative to the top of the layout so move them to be relative to the base line
+    const qreal ascent = layout.lineAt(0).ascent();
+    for (QGlyphRun &run : glyphRuns) {
+      QList<QPointF> positions = run.positions();
+      for (QPointF &position : positions) {
+        position.ry() -= ascent;
+      }
+      run.setPositions(positions);
+    }
+    StoredKey stored{key.fontId, key.codePage, key.device, std::string(key.text)};
+    return runs.insert_or_assign(std::move(stored), std::move(glyphRuns)).first->second;
+  }
+};
+
+GlyphRunCache &MainGlyphRuns() {
+  // Never destroyed as glyph runs must not outlive the application's fonts
+  static GlyphRunCache *glyphRuns = new GlyphRunCache();
+  return *glyphRuns;
+}
+
 } // namespace
 
 std::shared_ptr<Font> Font::Allocate(const FontParameters &fp) { return std::make_shared<FontAndCharacterSet>(fp); }
@@ -194,7 +379,12 @@ void SurfaceImpl::Release() noexcept { Clear(); }
 
 int SurfaceImpl::SupportsFeature(Supports feature) noexcept {
   for (const Supports f : SupportsQt) {
-    if (f == feature) return 1;
+    if (f == feature) {
+      if (feature == Supports::ThreadSafeMeasureWidths) {
+        return MeasuresAsDefaultDevice(device) ? 1 : 0;
+      }
+      return 1;
+    }
   }
   return 0;
 }
@@ -223,23 +413,10 @@ void SurfaceImpl::PenColourWidth(ColourRGBA fore, XYPOSITION strokeWidth) {
 
 void SurfaceImpl::BrushColour(ColourRGBA back) { GetPainter()->setBrush(QBrush(QColorFromColourRGBA(back))); }
 
-void SurfaceImpl::SetCodec(const Font *font) {
-  const FontAndCharacterSet *pfacs = AsFontAndCharacterSet(font);
-  if (pfacs && pfacs->pfont) {
-    const char *csid = "UTF-8";
-    if (!(mode.codePage == SC_CP_UTF8)) csid = CharacterSetID(pfacs->characterSet);
-    if (csid != codecName) {
-      codecName = csid;
-      decoder = std::make_unique<QStringDecoder>(csid);
-    }
-  }
-}
-
 void SurfaceImpl::SetFont(const Font *font) {
   const FontAndCharacterSet *pfacs = AsFontAndCharacterSet(font);
   if (pfacs && pfacs->pfont) {
     GetPainter()->setFont(*(pfacs->pfont));
-    SetCodec(font);
   }
 }
 
@@ -451,15 +628,31 @@ void SurfaceImpl::Copy(PRectangle rc, Point from, Surface &surfaceSource) {
 
 std::unique_ptr<IScreenLineLayout> SurfaceImpl::Layout(const IScreenLine *) { return {}; }
 
-void SurfaceImpl::DrawTextNoClip(PRectangle rc, const Font *font, XYPOSITION ybase, std::string_view text,
-                                 ColourRGBA fore, ColourRGBA back) {
-  SetFont(font);
+void SurfaceImpl::DrawGlyphRuns(const Font *font, XYPOSITION x, XYPOSITION ybase, std::string_view text, int codePage,
+                                ColourRGBA fore) {
+  const FontAndCharacterSet *pfacs = AsFontAndCharacterSet(font);
+  if (!pfacs || text.empty()) return;
+  GlyphRunCache &glyphRuns = MainGlyphRuns();
+  const GlyphRunKey key{pfacs->id, codePage, DeviceForRuns(MeasureDevice()), text};
+  const QList<QGlyphRun> *runs = glyphRuns.Find(key);
+  if (!runs) {
+    QTextLayout tlay(DecodeText(pfacs, codePage, text), *pfacs->pfont, MeasureDevice());
+    tlay.beginLayout();
+    tlay.createLine();
+    tlay.endLayout();
+    runs = &glyphRuns.Add(key, tlay);
+  }
   PenColour(fore);
+  const QPointF origin(x, ybase);
+  for (const QGlyphRun &run : *runs) {
+    GetPainter()->drawGlyphRun(origin, run);
+  }
+}
 
-  GetPainter()->setBackground(QColorFromColourRGBA(back));
-  GetPainter()->setBackgroundMode(Qt::OpaqueMode);
-  QString su = UnicodeFromText(decoder.get(), text);
-  GetPainter()->drawText(QPointF(rc.left, ybase), su);
+void SurfaceImpl::DrawTextNoClip(PRectangle rc, const Font *font, XYPOSITION ybase, std::string_view text,
+                                 ColourRGBA fore, ColourRGBA back) {
+  FillRectangle(rc, back);
+  DrawGlyphRuns(font, rc.left, ybase, text, mode.codePage, fore);
 }
 
 void SurfaceImpl::DrawTextClipped(PRectangle rc, const Font *font, XYPOSITION ybase, std::string_view text,
@@ -471,12 +664,7 @@ void SurfaceImpl::DrawTextClipped(PRectangle rc, const Font *font, XYPOSITION yb
 
 void SurfaceImpl::DrawTextTransparent(PRectangle rc, const Font *font, XYPOSITION ybase, std::string_view text,
                                       ColourRGBA fore) {
-  SetFont(font);
-  PenColour(fore);
-
-  GetPainter()->setBackgroundMode(Qt::TransparentMode);
-  QString su = UnicodeFromText(decoder.get(), text);
-  GetPainter()->drawText(QPointF(rc.left, ybase), su);
+  DrawGlyphRuns(font, rc.left, ybase, text, mode.codePage, fore);
 }
 
 void SurfaceImpl::SetClip(PRectangle rc) {
@@ -488,12 +676,12 @@ void SurfaceImpl::PopClip() { GetPainter()->restore(); }
 
 void SurfaceImpl::MeasureWidths(const Font *font, std::string_view text, XYPOSITION *positions) {
   if (!font) return;
-  SetCodec(font);
-  QString su = UnicodeFromText(decoder.get(), text);
-  QTextLayout tlay(su, *FontPointer(font), GetPaintDevice());
+  const QString su = DecodeText(AsFontAndCharacterSet(font), mode.codePage, text);
+  QTextLayout tlay(su, MeasureFont(font), MeasureDevice());
   tlay.beginLayout();
   QTextLine tl = tlay.createLine();
   tlay.endLayout();
+  KeepGlyphRuns(font, text, mode.codePage, tlay);
   if (mode.codePage == SC_CP_UTF8) {
     int fit = su.size();
     int ui = 0;
@@ -534,8 +722,7 @@ void SurfaceImpl::MeasureWidths(const Font *font, std::string_view text, XYPOSIT
 
 XYPOSITION SurfaceImpl::WidthText(const Font *font, std::string_view text) {
   QFontMetricsF metrics(*FontPointer(font), device);
-  SetCodec(font);
-  QString su = UnicodeFromText(decoder.get(), text);
+  const QString su = DecodeText(AsFontAndCharacterSet(font), mode.codePage, text);
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
   return metrics.horizontalAdvance(su);
 #else
@@ -545,13 +732,8 @@ XYPOSITION SurfaceImpl::WidthText(const Font *font, std::string_view text) {
 
 void SurfaceImpl::DrawTextNoClipUTF8(PRectangle rc, const Font *font, XYPOSITION ybase, std::string_view text,
                                      ColourRGBA fore, ColourRGBA back) {
-  SetFont(font);
-  PenColour(fore);
-
-  GetPainter()->setBackground(QColorFromColourRGBA(back));
-  GetPainter()->setBackgroundMode(Qt::OpaqueMode);
-  QString su = QString::fromUtf8(text.data(), static_cast<int>(text.length()));
-  GetPainter()->drawText(QPointF(rc.left, ybase), su);
+  FillRectangle(rc, back);
+  DrawGlyphRuns(font, rc.left, ybase, text, SC_CP_UTF8, fore);
 }
 
 void SurfaceImpl::DrawTextClippedUTF8(PRectangle rc, const Font *font, XYPOSITION ybase, std::string_view text,
@@ -563,21 +745,17 @@ void SurfaceImpl::DrawTextClippedUTF8(PRectangle rc, const Font *font, XYPOSITIO
 
 void SurfaceImpl::DrawTextTransparentUTF8(PRectangle rc, const Font *font, XYPOSITION ybase, std::string_view text,
                                           ColourRGBA fore) {
-  SetFont(font);
-  PenColour(fore);
-
-  GetPainter()->setBackgroundMode(Qt::TransparentMode);
-  QString su = QString::fromUtf8(text.data(), static_cast<int>(text.length()));
-  GetPainter()->drawText(QPointF(rc.left, ybase), su);
+  DrawGlyphRuns(font, rc.left, ybase, text, SC_CP_UTF8, fore);
 }
 
 void SurfaceImpl::MeasureWidthsUTF8(const Font *font, std::string_view text, XYPOSITION *positions) {
   if (!font) return;
-  QString su = QString::fromUtf8(text.data(), static_cast<int>(text.length()));
-  QTextLayout tlay(su, *FontPointer(font), GetPaintDevice());
+  const QString su = DecodeText(AsFontAndCharacterSet(font), SC_CP_UTF8, text);
+  QTextLayout tlay(su, MeasureFont(font), MeasureDevice());
   tlay.beginLayout();
   QTextLine tl = tlay.createLine();
   tlay.endLayout();
+  KeepGlyphRuns(font, text, SC_CP_UTF8, tlay);
   int fit = su.size();
   int ui = 0;
   size_t i = 0;
@@ -600,7 +778,7 @@ void SurfaceImpl::MeasureWidthsUTF8(const Font *font, std::string_view text, XYP
 
 XYPOSITION SurfaceImpl::WidthTextUTF8(const Font *font, std::string_view text) {
   QFontMetricsF metrics(*FontPointer(font), device);
-  QString su = QString::fromUtf8(text.data(), static_cast<int>(text.length()));
+  const QString su = DecodeText(AsFontAndCharacterSet(font), SC_CP_UTF8, text);
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
   return metrics.horizontalAdvance(su);
 #else
@@ -645,6 +823,31 @@ void SurfaceImpl::FlushDrawing() {}
 
 QPaintDevice *SurfaceImpl::GetPaintDevice() { return device; }
 
+const QFont &SurfaceImpl::MeasureFont(const Font *font) {
+  if (OnMainThread()) {
+    return *FontPointer(font);
+  }
+  return ThreadFont(AsFontAndCharacterSet(font));
+}
+
+void SurfaceImpl::KeepGlyphRuns(const Font *font, std::string_view text, int codePage, const QTextLayout &layout) {
+  // Text measured while painting is likely to be drawn next. Text measured for wrapping may never be drawn.
+  if (painter && OnMainThread()) {
+    GlyphRunCache &glyphRuns = MainGlyphRuns();
+    const GlyphRunKey key{AsFontAndCharacterSet(font)->id, codePage, DeviceForRuns(MeasureDevice()), text};
+    // Copying and moving the glyph runs is only worthwhile for segments not already kept
+    if (!glyphRuns.Find(key)) {
+      glyphRuns.Add(key, layout);
+    }
+  }
+}
+
+QPaintDevice *SurfaceImpl::MeasureDevice() {
+  // Paint devices belong to the main thread so workers measure without one. Surfaces whose
+  // device differs from that do not claim ThreadSafeMeasureWidths so never reach here off it.
+  return OnMainThread() ? device : nullptr;
+}
+
 QPainter *SurfaceImpl::GetPainter() {
 #ifndef PLAT_QT_QML
   Q_ASSERT(device);
@@ -815,13 +1018,53 @@ PRectangle Window::GetMonitorRect(Point pt) {
 }
 
 //----------------------------------------------------------------------
-class ListWidget : public QListWidget {
+// Holds the autocompletion items as one block of bytes and only converts an item to a QString
+// when the view asks for it, which, with uniform item sizes, is only for the visible rows.
+class ListModel : public QAbstractListModel {
+public:
+  explicit ListModel(QObject *parent);
+
+  int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+  QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+  void setUnicodeMode(bool unicodeMode_) noexcept;
+  void setImages(const QMap<int, QPixmap> *images_) noexcept;
+  void clear();
+  void append(std::string_view text, int type);
+  void setList(const char *list, char separator, char typesep);
+  [[nodiscard]] int count() const noexcept;
+  [[nodiscard]] std::string_view text(int row) const noexcept;
+  [[nodiscard]] QString displayText(int row) const;
+  [[nodiscard]] QString decode(std::string_view sv) const;
+  [[nodiscard]] const std::vector<int> &longestRows() const noexcept;
+
+private:
+  struct Item {
+    size_t start;
+    size_t length;
+    int type;
+  };
+  void appendItem(std::string_view text, int type);
+
+  std::string words;
+  std::vector<Item> items;
+  // Rows with the most bytes, longest first. Byte length only approximates the drawn width
+  // so a few candidates are kept and measured with the font.
+  static constexpr size_t widthCandidates = 8;
+  std::vector<int> longest;
+  bool unicodeMode = false;
+  const QMap<int, QPixmap> *images = nullptr;
+};
+
+class ListWidget : public QListView {
 public:
   explicit ListWidget(QWidget *parent);
 
   void setDelegate(IListBoxDelegate *lbDelegate);
+  [[nodiscard]] ListModel *listModel() const noexcept;
 
   int currentSelection();
+  void setCurrentRow(int row);
 
 protected:
   void selectionChanged(const QItemSelection &selected, const QItemSelection &deselected) override;
@@ -834,6 +1077,7 @@ protected:
 
 private:
   IListBoxDelegate *delegate;
+  ListModel *items;
 };
 
 class ListBoxImpl : public ListBox {
@@ -878,6 +1122,8 @@ void ListBoxImpl::Create(Window &parent, int /*ctrlID*/, Point location, int /*l
 
   QWidget *qparent = static_cast<QWidget *>(parent.GetID());
   ListWidget *list = new ListWidget(qparent);
+  list->listModel()->setUnicodeMode(unicodeMode);
+  list->listModel()->setImages(&images);
 
 #if defined(Q_OS_WIN)
   // On Windows, Qt::ToolTip causes a crash when the list is clicked on
@@ -932,8 +1178,15 @@ PRectangle ListBoxImpl::GetDesiredRect() {
   int rowHeight = list->sizeHintForRow(0);
   int height = (rows * rowHeight) + (2 * list->frameWidth());
 
+  // Measure only the few longest items instead of asking the view for every row which
+  // would convert and lay out the whole list.
   QStyle *style = QApplication::style();
-  int width = list->sizeHintForColumn(0) + (2 * list->frameWidth());
+  const ListModel *model = list->listModel();
+  int width = 0;
+  for (const int row : model->longestRows()) {
+    width = qMax(width, list->sizeHintForIndex(model->index(row, 0)).width());
+  }
+  width += 2 * list->frameWidth();
   if (Length() > rows) {
     width += style->pixelMetric(QStyle::PM_ScrollBarExtent);
   }
@@ -960,21 +1213,16 @@ int ListBoxImpl::CaretFromEdge() {
 }
 void ListBoxImpl::Clear() noexcept {
   ListWidget *list = GetWidget();
-  list->clear();
+  list->listModel()->clear();
 }
 void ListBoxImpl::Append(char *s, int type) {
   ListWidget *list = GetWidget();
-  QString str = unicodeMode ? QString::fromUtf8(s) : QString::fromLocal8Bit(s);
-  QIcon icon;
-  if (type >= 0) {
-    Q_ASSERT(images.contains(type));
-    icon = images.value(type);
-  }
-  new QListWidgetItem(icon, str, list);
+  Q_ASSERT(type < 0 || images.contains(type));
+  list->listModel()->append(s, type);
 }
 int ListBoxImpl::Length() {
   ListWidget *list = GetWidget();
-  return list->count();
+  return list->listModel()->count();
 }
 void ListBoxImpl::Select(int n) {
   ListWidget *list = GetWidget();
@@ -992,22 +1240,36 @@ int ListBoxImpl::GetSelection() {
   return list->currentSelection();
 }
 int ListBoxImpl::Find(const char *prefix) {
+  // Prefixes match ignoring case as QListWidget::findItems did so that lists shown with
+  // SCI_AUTOCSETIGNORECASE still find their entries. Pure ASCII is compared on the bytes
+  // and anything else is decoded and compared with Qt's case folding.
   ListWidget *list = GetWidget();
-  QString sPrefix = unicodeMode ? QString::fromUtf8(prefix) : QString::fromLocal8Bit(prefix);
-  QList<QListWidgetItem *> ms = list->findItems(sPrefix, Qt::MatchStartsWith);
-  int result = -1;
-  if (!ms.isEmpty()) {
-    result = list->row(ms.first());
+  const ListModel *model = list->listModel();
+  const std::string_view sPrefix(prefix);
+  const bool asciiPrefix = IsASCII(sPrefix);
+  QString qPrefix;
+  const int count = model->count();
+  for (int row = 0; row < count; row++) {
+    const std::string_view text = model->text(row);
+    if (asciiPrefix && IsASCII(text.substr(0, sPrefix.length()))) {
+      if (text.length() >= sPrefix.length() &&
+          CompareNCaseInsensitive(text.data(), sPrefix.data(), sPrefix.length()) == 0) {
+        return row;
+      }
+    } else {
+      if (qPrefix.isEmpty()) {
+        qPrefix = model->decode(sPrefix);
+      }
+      if (model->displayText(row).startsWith(qPrefix, Qt::CaseInsensitive)) {
+        return row;
+      }
+    }
   }
-
-  return result;
+  return -1;
 }
 std::string ListBoxImpl::GetValue(int n) {
   ListWidget *list = GetWidget();
-  QListWidgetItem *item = list->item(n);
-  QString str = item->data(Qt::DisplayRole).toString();
-  QByteArray bytes = unicodeMode ? str.toUtf8() : str.toLocal8Bit();
-  return std::string(bytes.constData());
+  return std::string(list->listModel()->text(n));
 }
 
 void ListBoxImpl::RegisterQPixmapImage(int type, const QPixmap &pm) {
@@ -1042,29 +1304,8 @@ void ListBoxImpl::SetDelegate(IListBoxDelegate *lbDelegate) {
   list->setDelegate(lbDelegate);
 }
 void ListBoxImpl::SetList(const char *list, char separator, char typesep) {
-  // This method is *not* platform dependent.
-  // It is borrowed from the GTK implementation.
-  Clear();
-  size_t count = strlen(list) + 1;
-  std::vector<char> words(list, list + count);
-  char *startword = &words[0];
-  char *numword = nullptr;
-  int i = 0;
-  for (; words[i]; i++) {
-    if (words[i] == separator) {
-      words[i] = '\0';
-      if (numword) *numword = '\0';
-      Append(startword, numword ? atoi(numword + 1) : -1);
-      startword = &words[0] + i + 1;
-      numword = nullptr;
-    } else if (words[i] == typesep) {
-      numword = &words[0] + i;
-    }
-  }
-  if (startword) {
-    if (numword) *numword = '\0';
-    Append(startword, numword ? atoi(numword + 1) : -1);
-  }
+  ListWidget *listWidget = GetWidget();
+  listWidget->listModel()->setList(list, separator, typesep);
 }
 void ListBoxImpl::SetOptions(ListOptions) {}
 ListWidget *ListBoxImpl::GetWidget() const noexcept { return static_cast<ListWidget *>(wid); }
@@ -1073,12 +1314,119 @@ ListBox::ListBox() noexcept = default;
 ListBox::~ListBox() noexcept = default;
 
 std::unique_ptr<ListBox> ListBox::Allocate() { return std::make_unique<ListBoxImpl>(); }
-ListWidget::ListWidget(QWidget *parent) : QListWidget(parent), delegate(nullptr) {}
+ListModel::ListModel(QObject *parent) : QAbstractListModel(parent) {}
+
+int ListModel::rowCount(const QModelIndex &parent) const {
+  return parent.isValid() ? 0 : count();
+}
+
+QVariant ListModel::data(const QModelIndex &index, int role) const {
+  if (!index.isValid() || index.row() >= count()) {
+    return QVariant();
+  }
+  switch (role) {
+  case Qt::DisplayRole: return displayText(index.row());
+  case Qt::DecorationRole: {
+    const int type = items[index.row()].type;
+    if (type >= 0 && images && images->contains(type)) {
+      return QIcon(images->value(type));
+    }
+    return QVariant();
+  }
+  default: return QVariant();
+  }
+}
+
+void ListModel::setUnicodeMode(bool unicodeMode_) noexcept { unicodeMode = unicodeMode_; }
+
+void ListModel::setImages(const QMap<int, QPixmap> *images_) noexcept { images = images_; }
+
+void ListModel::clear() {
+  beginResetModel();
+  words.clear();
+  items.clear();
+  longest.clear();
+  endResetModel();
+}
+
+void ListModel::appendItem(std::string_view text, int type) {
+  items.push_back(Item{words.length(), text.length(), type});
+  words.append(text);
+  if (longest.size() < widthCandidates || text.length() > items[longest.back()].length) {
+    const auto pos = std::find_if(longest.begin(), longest.end(),
+                                  [&](int row) { return text.length() > items[row].length; });
+    longest.insert(pos, count() - 1);
+    if (longest.size() > widthCandidates) {
+      longest.pop_back();
+    }
+  }
+}
+
+void ListModel::append(std::string_view text, int type) {
+  beginInsertRows(QModelIndex(), count(), count());
+  appendItem(text, type);
+  endInsertRows();
+}
+
+// Parse the whole list into the model with a single reset so views are only updated once.
+void ListModel::setList(const char *list, char separator, char typesep) {
+  beginResetModel();
+  words.clear();
+  items.clear();
+  longest.clear();
+  const std::string_view sv(list);
+  words.reserve(sv.length());
+  size_t start = 0;
+  for (;;) {
+    size_t end = sv.find(separator, start);
+    if (end == std::string_view::npos) {
+      end = sv.length();
+    }
+    std::string_view entry = sv.substr(start, end - start);
+    int type = -1;
+    const size_t typeStart = entry.rfind(typesep);
+    if (typeStart != std::string_view::npos) {
+      type = atoi(std::string(entry.substr(typeStart + 1)).c_str());
+      entry = entry.substr(0, typeStart);
+    }
+    appendItem(entry, type);
+    if (end >= sv.length()) {
+      break;
+    }
+    start = end + 1;
+  }
+  endResetModel();
+}
+
+int ListModel::count() const noexcept { return static_cast<int>(items.size()); }
+
+std::string_view ListModel::text(int row) const noexcept {
+  if (row < 0 || row >= count()) {
+    return {};
+  }
+  return std::string_view(words).substr(items[row].start, items[row].length);
+}
+
+QString ListModel::displayText(int row) const { return decode(text(row)); }
+
+QString ListModel::decode(std::string_view sv) const {
+  return unicodeMode ? QString::fromUtf8(sv.data(), static_cast<qsizetype>(sv.length()))
+                     : QString::fromLocal8Bit(sv.data(), static_cast<qsizetype>(sv.length()));
+}
+
+const std::vector<int> &ListModel::longestRows() const noexcept { return longest; }
+
+ListWidget::ListWidget(QWidget *parent) : QListView(parent), delegate(nullptr), items(new ListModel(this)) {
+  setModel(items);
+  setSelectionMode(QAbstractItemView::SingleSelection);
+}
 
 void ListWidget::setDelegate(IListBoxDelegate *lbDelegate) { delegate = lbDelegate; }
 
+ListModel *ListWidget::listModel() const noexcept { return items; }
+
 void ListWidget::selectionChanged(const QItemSelection &selected, const QItemSelection &deselected) {
-  QListWidget::selectionChanged(selected, deselected);
+  QListView::selectionChanged(selected, deselected);
   if (delegate) {
     const int selection = currentSelection();
     if (selection >= 0) {
@@ -1096,6 +1444,15 @@ int ListWidget::currentSelection() {
   return -1;
 }
 
+void ListWidget::setCurrentRow(int row) {
+  const QModelIndex index = model()->index(row, 0);
+  if (index.isValid()) {
+    selectionModel()->setCurrentIndex(index, QItemSelectionModel::ClearAndSelect);
+  } else {
+    selectionModel()->clear();
+  }
+}
+
 void ListWidget::mouseDoubleClickEvent(QMouseEvent * /* event */) {
   if (delegate) {
     ListBoxEvent event(ListBoxEvent::EventType::doubleClick);
@@ -1105,12 +1462,12 @@ void ListWidget::mouseDoubleClickEvent(QMouseEvent * /* event */) {
 
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
 void ListWidget::initViewItemOption(QStyleOptionViewItem *option) const {
-  QListWidget::initViewItemOption(option);
+  QListView::initViewItemOption(option);
   option->state |= QStyle::State_Active;
 }
 #else
 QStyleOptionViewItem ListWidget::viewOptions() const {
-  QStyleOptionViewItem result = QListWidget::viewOptions();
+  QStyleOptionViewItem result = QListView::viewOptions();
   result.state |= QStyle::State_Active;
   return result;
 }
@@ -13,6 +13,7 @@
 #include <QPaintDevice>
 #include <QPainter>
 #include <QStringDecoder>
+#include <QTextLayout>
 #include <QUrl>
 #include <cstddef>
 #include <memory>
@@ -65,8 +66,6 @@ private:
   bool deviceOwned = false;
   bool painterOwned = false;
   SurfaceMode mode;
-  const char *codecName = nullptr;
-  std::unique_ptr<QStringDecoder> decoder = nullptr;
 
   void Clear();
 
@@ -138,10 +137,15 @@ public:
   void FlushDrawing() override;
 
   void BrushColour(ColourRGBA back);
-  void SetCodec(const Font *font);
   void SetFont(const Font *font);
+  void DrawGlyphRuns(const Font *font, XYPOSITION x, XYPOSITION ybase, std::string_view text, int codePage,
+                     ColourRGBA fore);
 
   QPaintDevice *GetPaintDevice();
+  // Measurement may be performed on layout worker threads
+  const QFont &MeasureFont(const Font *font);
+  QPaintDevice *MeasureDevice();
+  void KeepGlyphRuns(const Font *font, std::string_view text, int codePage, const QTextLayout &layout);
   void SetPainter(QPainter *painter);
   QPainter *GetPainter();
 };
@@ -10,17 +10,26 @@
 
 #include "ScintillaEditBase.h"
 #include "Geometry.h"
+#include "ILoader.h"
 #include "PlatQt.h"
 #include "ScintillaQt.h"
 
 #include <QApplication>
+#include <QFile>
 #if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
 #include <QInputContext>
 #endif
 #include <QPainter>
+#include <QSaveFile>
 #include <QScrollBar>
+#include <QStringDecoder>
+#include <QStringEncoder>
 #include <QTextFormat>
 #include <QVarLengthArray>
+#include <atomic>
+#include <limits>
+#include <optional>
+#include <thread>
 #ifdef PLAT_QT_QML
 #include <QList>
 #include <QPair>
@@ -127,7 +136,166 @@ ScintillaEditBase::ScintillaEditBase(QWidget *parent)
 #endif
 }
 
-ScintillaEditBase::~ScintillaEditBase() = default;
+// State shared between the GUI thread and the worker thread of loadFileAsync.
+// The worker only writes results; the GUI thread reads them after joining and owns the loader.
+struct ScintillaEditBase::AsyncLoad {
+  std::thread thread;
+  std::atomic<bool> cancelled = false;
+  ILoader *loader = nullptr;
+  int codePage = SC_CP_UTF8;
+  const char *fallbackCodec = nullptr;
+  bool success = false;
+  QString errorString;
+  int eolMode = -1;
+};
+
+// A document kept alive and read-only while a worker thread writes it
+struct ScintillaEditBase::AsyncSave {
+  std::thread thread;
+  Document *doc = nullptr;
+  bool readOnlyBefore = false;
+  bool success = false;
+  QString errorString;
+};
+
+namespace {
+
+constexpr qint64 loadChunkSize = 0x100000;
+constexpr size_t saveChunkSize = 0x100000;
+
+// Finds the first line end so the loaded document can keep the file's convention
+class LineEndDetector {
+  bool pendingCR = false;
+
+public:
+  int eolMode = -1;
+  void Scan(const char *s, qsizetype length) noexcept {
+    for (qsizetype i = 0; (i < length) && (eolMode < 0); i++) {
+      if (pendingCR) {
+        eolMode = (s[i] == '\n') ? SC_EOL_CRLF : SC_EOL_CR;
+      } else if (s[i] == '\r') {
+        pendingCR = true;
+      } else if (s[i] == '\n') {
+        eolMode = SC_EOL_LF;
+      }
+    }
+  }
+  void Finish() noexcept {
+    if (pendingCR && (eolMode < 0)) {
+      eolMode = SC_EOL_CR;
+    }
+  }
+};
+
+// Decoder converting the file to UTF-8 chosen from a byte order mark or the first chunk.
+// Text that is not UTF-8 is decoded with fallbackCodec, normally the codec of the document's
+// character set. No decoder means the bytes are added unchanged.
+std::optional<QStringDecoder> DetectEncoding(QByteArrayView &data, const char *fallbackCodec) {
+  if (data.startsWith("\xEF\xBB\xBF")) {
+    data = data.sliced(3);
+    return {};
+  }
+  if (data.startsWith("\xFF\xFE")) {
+    data = data.sliced(2);
+    return QStringDecoder(QStringDecoder::Utf16LE);
+  }
+  if (data.startsWith("\xFE\xFF")) {
+    data = data.sliced(2);
+    return QStringDecoder(QStringDecoder::Utf16BE);
+  }
+  QStringDecoder utf8(QStringDecoder::Utf8);
+  [[maybe_unused]] const QString decoded = utf8.decode(data);
+  if (utf8.hasError() && fallbackCodec) {
+    QStringDecoder fallback(fallbackCodec);
+    if (fallback.isValid()) {
+      return fallback;
+    }
+  }
+  return {};
+}
+
+// Codec of the bytes in a document: its DBCS code page when set, otherwise its character set
+const char *DocumentCodec(int codePage, const char *characterSetCodec) noexcept {
+  switch (codePage) {
+  case SC_CP_UTF8: return "UTF-8";
+  case 932: return "Shift-JIS";
+  case 936: return "GBK";
+  case 949: return "CP949";
+  case 950: return "Big5";
+  case 1361: return "CP1361";
+  default: return characterSetCodec;
+  }
+}
+
+// Writes pieces of a document to a device, converting from the document's encoding when a codec is named
+class DeviceWriter : public TextWriter {
+  QIODevice *device;
+  std::optional<QStringDecoder> decoder;
+  std::optional<QStringEncoder> encoder;
+
+public:
+  DeviceWriter(QIODevice *device_, const QString &encoding, const char *documentCodec) : device(device_) {
+    if (!encoding.isEmpty()) {
+      decoder.emplace(documentCodec);
+      encoder.emplace(encoding.toLatin1().constData());
+    }
+  }
+  bool Valid() const { return (!decoder || decoder->isValid()) && (!encoder || encoder->isValid()); }
+  bool Write(std::string_view text) override {
+    if (encoder) {
+      // The decoder keeps state so characters split between pieces are converted correctly
+      const QString decoded = decoder->decode(QByteArrayView(text.data(), text.size()));
+      const QByteArray encoded = encoder->encode(decoded);
+      return device->write(encoded) == encoded.size();
+    }
+    return device->write(text.data(), text.size()) == static_cast<qint64>(text.size());
+  }
+};
+
+std::optional<EndOfLine> EndOfLineFromMode(int eolMode) {
+  if ((eolMode >= SC_EOL_CRLF) && (eolMode <= SC_EOL_LF)) {
+    return static_cast<EndOfLine>(eolMode);
+  }
+  return {};
+}
+
+// Streams doc into a file which only replaces the original when complete
+QString SaveDocument(const Document *doc, const QString &fileName, int eolMode, const QString &encoding,
+                     const char *documentCodec) {
+  QSaveFile file(fileName);
+  if (!file.open(QIODevice::WriteOnly)) {
+    return file.errorString();
+  }
+  DeviceWriter writer(&file, encoding, documentCodec);
+  if (!writer.Valid()) {
+    file.cancelWriting();
+    return QStringLiteral("Cannot convert from %1 to %2").arg(QLatin1String(documentCodec), encoding);
+  }
+  if (!doc->WriteText(writer, saveChunkSize, EndOfLineFromMode(eolMode))) {
+    const QString error = file.errorString();
+    file.cancelWriting();
+    return error;
+  }
+  if (!file.commit()) {
+    return file.errorString();
+  }
+  return QString();
+}
+
+} // namespace
+
+ScintillaEditBase::~ScintillaEditBase() {
+  if (asyncLoad) {
+    asyncLoad->cancelled = true;
+    asyncLoad->thread.join();
+    asyncLoad->loader->Release();
+  }
+  if (asyncSave) {
+    asyncSave->thread.join();
+    asyncSave->doc->SetReadOnly(asyncSave->readOnlyBefore);
+    asyncSave->doc->Release();
+  }
+}
 
 sptr_t ScintillaEditBase::send(unsigned int iMessage, uptr_t wParam, sptr_t lParam) const {
   return sqt->WndProc(static_cast<Message>(iMessage), wParam, lParam);
@@ -137,6 +305,193 @@ sptr_t ScintillaEditBase::sends(unsigned int iMessage, uptr_t wParam, const char
   return sqt->WndProc(static_cast<Message>(iMessage), wParam, reinterpret_cast<sptr_t>(s));
 }
 
+QVariantMap ScintillaEditBase::profileCounters() const {
+  const auto counter = [this](int id) -> qint64 { return send(SCI_GETPROFILECOUNTER, id); };
+  const qint64 hits = counter(SC_PROFILE_POSITION_CACHE_HITS);
+  const qint64 measured = counter(SC_PROFILE_MEASURED_RUNS);
+  QVariantMap counters;
+  counters["paints"] = counter(SC_PROFILE_PAINTS);
+  counters["paintTime"] = counter(SC_PROFILE_PAINT_TIME);
+  counters["layoutTime"] = counter(SC_PROFILE_LAYOUT_TIME);
+  counters["linesLaidOut"] = counter(SC_PROFILE_LINES_LAID_OUT);
+  counters["measuredRuns"] = measured;
+  counters["positionCacheHits"] = hits;
+  counters["positionCacheHitRate"] = (hits + measured) > 0 ? static_cast<double>(hits) / (hits + measured) : 0.0;
+  counters["styledBytes"] = counter(SC_PROFILE_STYLED_BYTES);
+  counters["wrapTime"] = counter(SC_PROFILE_WRAP_TIME);
+  counters["idleTime"] = counter(SC_PROFILE_IDLE_TIME);
+  return counters;
+}
+
+void ScintillaEditBase::resetProfileCounters() { send(SCI_RESETPROFILECOUNTERS); }
+
+bool ScintillaEditBase::loadFileAsync(const QString &fileName) {
+  cancelLoad();
+  auto file = std::make_unique<QFile>(fileName);
+  if (!file->open(QIODevice::ReadOnly)) {
+    emit loadFinished(false, file->errorString());
+    return false;
+  }
+  const qint64 size = file->size();
+  // Conversion to UTF-8 may expand text so switch to 64-bit positions well before 2 GB
+  const int options =
+      (size > std::numeric_limits<int>::max() / 2) ? SC_DOCUMENTOPTION_TEXT_LARGE : SC_DOCUMENTOPTION_DEFAULT;
+  ILoader *loader = reinterpret_cast<ILoader *>(send(SCI_CREATELOADER, size, options));
+  if (!loader) {
+    emit loadFinished(false, QStringLiteral("Not enough memory to load file"));
+    return false;
+  }
+
+  auto load = std::make_shared<AsyncLoad>();
+  load->loader = loader;
+  load->codePage = static_cast<int>(send(SCI_GETCODEPAGE));
+  // Character set codec names are string literals so may be used by the worker
+  load->fallbackCodec = sqt->CharacterSetIDOfDocument();
+  asyncLoad = load;
+  load->thread = std::thread([this, load, file = std::move(file), size]() {
+    LineEndDetector lineEnds;
+    std::optional<QStringDecoder> decoder;
+    QByteArray buffer(loadChunkSize, Qt::Uninitialized);
+    qint64 bytesRead = 0;
+    while (!load->cancelled) {
+      const qint64 lengthRead = file->read(buffer.data(), loadChunkSize);
+      if (lengthRead <= 0) {
+        if (lengthRead < 0) {
+          load->errorString = file->errorString();
+        }
+        break;
+      }
+      QByteArrayView data(buffer.constData(), lengthRead);
+      if ((bytesRead == 0) && (load->codePage == SC_CP_UTF8)) {
+        decoder = DetectEncoding(data, load->fallbackCodec);
+      }
+      bytesRead += lengthRead;
+      int status = SC_STATUS_OK;
+      if (decoder) {
+        const QByteArray text = QString(decoder->decode(data)).toUtf8();
+        lineEnds.Scan(text.constData(), text.size());
+        status = load->loader->AddData(text.constData(), text.size());
+      } else {
+        lineEnds.Scan(data.data(), data.size());
+        status = load->loader->AddData(data.data(), data.size());
+      }
+      if (status != SC_STATUS_OK) {
+        load->errorString = (status == SC_STATUS_BADALLOC) ? QStringLiteral("Not enough memory to load file")
+                                                           : QStringLiteral("Failed to load file");
+        break;
+      }
+      QMetaObject::invokeMethod(
+          this,
+          [this, load, bytesRead, size]() {
+            if (load == asyncLoad) {
+              emit loadProgress(bytesRead, size);
+            }
+          },
+          Qt::QueuedConnection);
+    }
+    lineEnds.Finish();
+    load->eolMode = lineEnds.eolMode;
+    load->success = !load->cancelled && load->errorString.isEmpty();
+    QMetaObject::invokeMethod(this, [this, load]() { finishLoad(load); }, Qt::QueuedConnection);
+  });
+  return true;
+}
+
+void ScintillaEditBase::cancelLoad() {
+  if (!asyncLoad) {
+    return;
+  }
+  // Any notifications still queued by the worker are ignored as they no longer match asyncLoad
+  const std::shared_ptr<AsyncLoad> load = std::move(asyncLoad);
+  asyncLoad.reset();
+  load->cancelled = true;
+  load->thread.join();
+  load->loader->Release();
+  emit loadFinished(false, QString());
+}
+
+bool ScintillaEditBase::isLoading() const { return asyncLoad != nullptr; }
+
+bool ScintillaEditBase::writeTo(QIODevice *device, int eolMode, const QString &encoding) const {
+  DeviceWriter writer(device, encoding, DocumentCodec(sqt->pdoc->dbcsCodePage, sqt->CharacterSetIDOfDocument()));
+  return writer.Valid() && sqt->pdoc->WriteText(writer, saveChunkSize, EndOfLineFromMode(eolMode));
+}
+
+bool ScintillaEditBase::saveFile(const QString &fileName, int eolMode, const QString &encoding) {
+  return SaveDocument(sqt->pdoc, fileName, eolMode, encoding,
+                      DocumentCodec(sqt->pdoc->dbcsCodePage, sqt->CharacterSetIDOfDocument()))
+      .isEmpty();
+}
+
+bool ScintillaEditBase::saveFileAsync(const QString &fileName, int eolMode, const QString &encoding) {
+  if (asyncSave) {
+    return false;
+  }
+  auto save = std::make_shared<AsyncSave>();
+  save->doc = sqt->pdoc;
+  // Hold a reference in case the document is replaced before the save completes
+  save->doc->AddRef();
+  save->readOnlyBefore = save->doc->IsReadOnly();
+  save->doc->SetReadOnly(true);
+  // The worker reads the text in place. Moving the gap to the end now means later requests for
+  // the character pointer or a range pointer do not move text while it is being read.
+  save->doc->BufferPointer();
+  // Codec names are string literals so may be used by the worker
+  const char *documentCodec = DocumentCodec(save->doc->dbcsCodePage, sqt->CharacterSetIDOfDocument());
+  sqt->savingDocument = save->doc;
+  asyncSave = save;
+  save->thread = std::thread([this, save, fileName, eolMode, encoding, documentCodec]() {
+    save->errorString = SaveDocument(save->doc, fileName, eolMode, encoding, documentCodec);
+    save->success = save->errorString.isEmpty();
+    QMetaObject::invokeMethod(this, [this, save]() { finishSave(save); }, Qt::QueuedConnection);
+  });
+  return true;
+}
+
+bool ScintillaEditBase::isSaving() const { return asyncSave != nullptr; }
+
+void ScintillaEditBase::finishSave(const std::shared_ptr<AsyncSave> &save) {
+  asyncSave.reset();
+  save->thread.join();
+  sqt->savingDocument = nullptr;
+  save->doc->SetReadOnly(save->readOnlyBefore);
+  save->doc->Release();
+  emit saveFinished(save->success, save->errorString);
+}
+
+void ScintillaEditBase::finishLoad(const std::shared_ptr<AsyncLoad> &load) {
+  if (load != asyncLoad) {
+    // Cancelled or replaced by another load which has already cleaned up
+    return;
+  }
+  asyncLoad.reset();
+  load->thread.join();
+  if (!load->success) {
+    load->loader->Release();
+    emit loadFinished(false, load->errorString);
+    return;
+  }
+  void *doc = load->loader->ConvertToDocument();
+  send(SCI_SETDOCPOINTER, 0, reinterpret_cast<sptr_t>(doc));
+  // The editor now holds its own reference to the document
+  send(SCI_RELEASEDOCUMENT, 0, reinterpret_cast<sptr_t>(doc));
+  // Loaders do not collect undo
+  send(SCI_SETUNDOCOLLECTION, 1);
+  send(SCI_EMPTYUNDOBUFFER);
+  if (load->codePage != SC_CP_UTF8) {
+    send(SCI_SETCODEPAGE, load->codePage);
+  }
+  if (load->eolMode >= 0) {
+    send(SCI_SETEOLMODE, load->eolMode);
+  }
+#ifdef PLAT_QT_QML
+  emit textChanged();
+  emit totalColumnsChanged();
+  emit totalLinesChanged();
+#endif
+  emit loadFinished(true, QString());
+}
+
 #ifdef PLAT_QT_QML
 
 void ScintillaEditBase::scrollRow(int deltaLines) {
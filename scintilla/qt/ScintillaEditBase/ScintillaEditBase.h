@@ -12,7 +12,10 @@
 // Scintilla platform layer for Qt QML/Quick
 
 #include <QElapsedTimer>
+#include <QIODevice>
 #include <QMimeData>
+#include <QVariantMap>
+#include <memory>
 #include "Platform.h"
 #include "SciLexer.h"
 #include "Scintilla.h"
@@ -81,6 +84,29 @@ public:
 
   virtual sptr_t sends(unsigned int iMessage, uptr_t wParam = 0, const char *s = 0) const;
 
+  // Costs of painting, layout and styling since the last reset, with times in microseconds.
+  Q_INVOKABLE QVariantMap profileCounters() const;
+  Q_INVOKABLE void resetProfileCounters();
+
+  // Read a file on a worker thread into a new document that replaces the current document once complete.
+  // Progress is reported by loadProgress and the result by loadFinished.
+  // Byte order marks are removed and text that is not UTF-8 is converted when the code page is UTF-8.
+  // Per-document settings such as the lexer should be applied again after loadFinished.
+  Q_INVOKABLE bool loadFileAsync(const QString &fileName);
+  Q_INVOKABLE void cancelLoad();
+  Q_INVOKABLE bool isLoading() const;
+
+  // Write the document in fixed size chunks straight from the buffer without copying the whole text.
+  // eolMode is an SC_EOL_* value to convert line ends or -1 to keep them.
+  // encoding names a codec to convert to or is empty to write the document's bytes unchanged.
+  bool writeTo(QIODevice *device, int eolMode = -1, const QString &encoding = QString()) const;
+  Q_INVOKABLE bool saveFile(const QString &fileName, int eolMode = -1, const QString &encoding = QString());
+  // As saveFile but on a worker thread with the result reported by saveFinished.
+  // The document is read-only until then so the worker reads an unchanging snapshot;
+  // SCI_SETREADONLY and SCI_ALLOCATE are ignored by this editor while saving.
+  Q_INVOKABLE bool saveFileAsync(const QString &fileName, int eolMode = -1, const QString &encoding = QString());
+  Q_INVOKABLE bool isSaving() const;
+
 #ifdef PLAT_QT_QML
   Q_INVOKABLE void scrollRow(int deltaLines);
   Q_INVOKABLE void scrollRowAbsolute(int firstVisible);
@@ -140,6 +166,11 @@ signals:
   void autoCompleteCancelled();
   void focusChanged(bool focused);
 
+  // Asynchronous loading, errorString is empty when the load was cancelled
+  void loadProgress(qint64 bytesRead, qint64 bytesTotal);
+  void loadFinished(bool success, const QString &errorString);
+  void saveFinished(bool success, const QString &errorString);
+
   // Base notifications for compatibility with other Scintilla implementations
   void notify(Scintilla::NotificationData *pscn);
   void command(Scintilla::uptr_t wParam, Scintilla::sptr_t lParam);
@@ -258,6 +289,13 @@ protected:
 
   int wheelDelta;
 
+  struct AsyncLoad;
+  std::shared_ptr<AsyncLoad> asyncLoad;
+  void finishLoad(const std::shared_ptr<AsyncLoad> &load);
+  struct AsyncSave;
+  std::shared_ptr<AsyncSave> asyncSave;
+  void finishSave(const std::shared_ptr<AsyncSave> &save);
+
   static bool IsHangul(const QChar qchar);
   void MoveImeCarets(Scintilla::Position offset);
   void DrawImeIndicator(int indicator, int len);
@@ -848,6 +848,14 @@ sptr_t ScintillaQt::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam)
 		case Message::GetRectangularSelectionModifier:
 			return rectangularSelectionModifier;
 
+		case Message::SetReadOnly:
+		case Message::Allocate:
+			// A worker thread is reading the text so it must not be made writable or reallocated
+			if (savingDocument && (pdoc == savingDocument)) {
+				break;
+			}
+			return ScintillaBase::WndProc(iMessage, wParam, lParam);
+
 		default:
 			return ScintillaBase::WndProc(iMessage, wParam, lParam);
 		}
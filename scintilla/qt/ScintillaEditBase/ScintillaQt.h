@@ -153,6 +153,9 @@ private:
   QPainter *currentPainter; // temporary variable for paint() handling
 #endif
 
+  // Document being written by ScintillaEditBase::saveFileAsync which must stay read-only and unmoved
+  const Document *savingDocument = nullptr;
+
   friend class ::ScintillaEditBase;
 };
 } // namespace Scintilla::Internal
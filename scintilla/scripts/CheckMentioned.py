@@ -67,6 +67,8 @@ def convertIFaceTypeToC(t):
 		return "Sci_TextToFindFull *"
 	elif t == "formatrangefull":
 		return "Sci_RangeToFormatFull *"
+	elif t == "indicatorfills":
+		return "Sci_IndicatorFill *"
 	elif Face.IsEnumeration(t):
 		return "int "
 	return t + " "
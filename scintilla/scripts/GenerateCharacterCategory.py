@@ -1,6 +1,7 @@
 #!/usr/bin/env python3
 # Script to generate scintilla/src/CharacterCategoryMap.cxx and lexilla/lexlib/CharacterCategory.cxx
-# from Python's Unicode data
+# from Python's Unicode data.
+# Scintilla gets a sorted list of ranges and Lexilla gets two-stage lookup tables.
 # Should be run rarely when a Python with a new version of Unicode data is available.
 # Requires Python 3.3 or later
 # Should not be run with old versions of Python.
@@ -43,11 +44,51 @@ def updateCharacterCategory(filename):
 
     Regenerate(filename, "//", values)
 
+# Split the category of every character into blocks of 1 << shift characters.
+# Identical blocks are stored once in stage2 and stage1 holds the block number for each
+# block of characters, so looking up a category is two array accesses.
+def stageTables(characterCategories, shift):
+    blockSize = 1 << shift
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, len(characterCategories), blockSize):
+        block = tuple(characterCategories[start:start + blockSize])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+def formatArray(name, elementType, values):
+    lines = ["constexpr %s %s[] = {" % (elementType, name)]
+    perLine = 32
+    for start in range(0, len(values), perLine):
+        lines.append(",".join(str(v) for v in values[start:start + perLine]) + ",")
+    lines.append("};")
+    return lines
+
+def tableValues(characterCategories, created):
+    # 7 was the smallest total size for Unicode 15 with the block numbers fitting in a byte
+    shift = 7
+    stage1, stage2 = stageTables(characterCategories, shift)
+    stage1Type = "unsigned char" if max(stage1) < 256 else "unsigned short"
+    values = [created, "constexpr int catShift = %d;" % shift]
+    values.extend(formatArray("catStage1", stage1Type, stage1))
+    values.extend(formatArray("catStage2", "unsigned char", stage2))
+    return values
+
+def updateCharacterCategoryTables(filename):
+    created = "// Created with Python %s,  Unicode %s" % (
+        platform.python_version(), unicodedata.unidata_version)
+    characterCategories = [categories.index(unicodedata.category(chr(ch))) for ch in range(sys.maxunicode + 1)]
+    Regenerate(filename, "//", tableValues(characterCategories, created))
 
 scintillaDirectory = pathlib.Path(__file__).resolve().parent.parent
 
 categories = findCategories(scintillaDirectory / "src" / "CharacterCategoryMap.h")
 
-updateCharacterCategory(scintillaDirectory / "src" / "CharacterCategoryMap.cxx")
+if __name__ == "__main__":
+    updateCharacterCategory(scintillaDirectory / "src" / "CharacterCategoryMap.cxx")
 
-updateCharacterCategory(scintillaDirectory.parent / "lexilla" / "lexlib" / "CharacterCategory.cxx")
+    updateCharacterCategoryTables(scintillaDirectory.parent / "lexilla" / "lexlib" / "CharacterCategory.cxx")
@@ -22,6 +22,7 @@ typeAliases = {
 	"findtextfull": "TextToFindFull *",
 	"formatrange": "void *",
 	"formatrangefull": "RangeToFormatFull *",
+	"indicatorfills": "IndicatorFill *",
 	"int": "int",
 	"keymod": "int",
 	"line": "Line",
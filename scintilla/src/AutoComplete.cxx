@@ -6,6 +6,7 @@
 // The License.txt file describes the conditions under which this software may be distributed.
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cassert>
 #include <cstring>
@@ -33,10 +34,115 @@
 using namespace Scintilla;
 using namespace Scintilla::Internal;
 
+namespace {
+
+// Weights used by FuzzyScore.
+constexpr int scoreMatch = 16;
+constexpr int bonusConsecutive = 8;
+constexpr int bonusWordStart = 12;
+constexpr int bonusExactCase = 1;
+constexpr int penaltyGap = 1;
+constexpr int maxLeadingPenalty = 3;
+// Only this many bytes of each entry are scored so very long entries can not make typing slow.
+constexpr size_t fuzzyMaxLength = 256;
+
+constexpr unsigned char FoldCase(char ch) noexcept {
+	return MakeLowerCase(static_cast<unsigned char>(ch));
+}
+
+// Favour matches at the start of the entry, after punctuation, at camel-case humps and at the start of numbers.
+int PositionBonus(std::string_view candidate, size_t position) noexcept {
+	if (position == 0)
+		return bonusWordStart;
+	const unsigned char previous = candidate[position - 1];
+	const unsigned char ch = candidate[position];
+	if (IsASCII(previous) && !IsAlphaNumeric(previous))
+		return bonusWordStart;
+	if (IsUpperCase(ch) && !IsUpperCase(previous))
+		return bonusWordStart;
+	if (IsADigit(ch) && !IsADigit(previous))
+		return bonusWordStart / 2;
+	return 0;
+}
+
+}
+
+std::uint64_t Scintilla::Internal::FuzzyMask(std::string_view text) noexcept {
+	std::uint64_t mask = 0;
+	for (const char ch : text) {
+		mask |= std::uint64_t(1) << (FoldCase(ch) & 0x3f);
+	}
+	return mask;
+}
+
+int Scintilla::Internal::FuzzyScore(std::string_view query, std::string_view candidate) {
+	if (query.empty())
+		return 0;
+	if (candidate.length() > fuzzyMaxLength)
+		candidate = candidate.substr(0, fuzzyMaxLength);
+
+	// Greedy scans from each end reject non-subsequences and bound the table to the columns
+	// between the earliest possible first match and the latest possible last match.
+	size_t first = 0;
+	size_t position = 0;
+	for (size_t i = 0; i < query.length(); i++) {
+		const unsigned char q = FoldCase(query[i]);
+		while ((position < candidate.length()) && (FoldCase(candidate[position]) != q))
+			position++;
+		if (position >= candidate.length())
+			return fuzzyNoMatch;
+		if (i == 0)
+			first = position;
+		position++;
+	}
+	size_t end = candidate.length();
+	while (FoldCase(candidate[end - 1]) != FoldCase(query.back()))
+		end--;
+	const size_t width = end - first;
+
+	// previous[j] and current[j] are the best scores with the previous and current query
+	// characters matched at candidate[first + j].
+	std::vector<int> previous(width, fuzzyNoMatch);
+	std::vector<int> current(width, fuzzyNoMatch);
+	for (size_t i = 0; i < query.length(); i++) {
+		const unsigned char q = FoldCase(query[i]);
+		// Best score from the previous row followed by a gap before column j
+		int gapBest = fuzzyNoMatch;
+		for (size_t j = 0; j < width; j++) {
+			position = first + j;
+			int score = fuzzyNoMatch;
+			if (FoldCase(candidate[position]) == q) {
+				int base = fuzzyNoMatch;
+				if (i == 0) {
+					base = -penaltyGap * static_cast<int>(std::min<size_t>(position, maxLeadingPenalty));
+				} else {
+					base = gapBest;
+					if ((j > 0) && (previous[j - 1] > fuzzyNoMatch))
+						base = std::max(base, previous[j - 1] + bonusConsecutive);
+				}
+				if (base > fuzzyNoMatch) {
+					score = base + scoreMatch + PositionBonus(candidate, position);
+					if (candidate[position] == query[i])
+						score += bonusExactCase;
+				}
+			}
+			current[j] = score;
+			if (j > 0)
+				gapBest = std::max(gapBest, previous[j - 1]) - penaltyGap;
+		}
+		std::swap(previous, current);
+	}
+	const int best = *std::max_element(previous.begin(), previous.end());
+	return (best > fuzzyNoMatch) ? best : fuzzyNoMatch;
+}
+
 AutoComplete::AutoComplete() :
 	active(false),
 	separator(' '),
 	typesep('?'),
+	previousStart(0),
+	previousEnd(-1),
+	filtered(false),
 	ignoreCase(false),
 	chooseSingle(false),
 	options(AutoCompleteOption::Normal),
@@ -71,11 +177,25 @@ void AutoComplete::Start(Window &parent, int ctrlID,
 	lb->SetOptions(listOptions);
 	lb->Create(parent, ctrlID, location, lineHeight, unicodeMode, technology);
 	lb->Clear();
+	ResetPrevious();
 	active = true;
 	startLen = startLen_;
 	posStart = position;
 }
 
+void AutoComplete::ResetPrevious() noexcept {
+	previousWord.clear();
+	previousStart = 0;
+	previousEnd = -1;
+}
+
+int AutoComplete::CompareItem(const char *word, size_t lenWord, int index, bool caseSensitive) const {
+	const std::string item = GetValue(sortMatrix[index]);
+	if (caseSensitive)
+		return strncmp(word, item.c_str(), lenWord);
+	return CompareNCaseInsensitive(word, item.c_str(), lenWord);
+}
+
 void AutoComplete::SetStopChars(const char *stopChars_) {
 	stopChars = stopChars_;
 }
@@ -157,11 +277,13 @@ struct Sorter {
 };
 
 void AutoComplete::SetList(const char *list) {
+	ResetPrevious();
 	if (autoSort == Ordering::PreSorted) {
 		lb->SetList(list, separator, typesep);
 		sortMatrix.clear();
 		for (int i = 0; i < lb->Length(); ++i)
 			sortMatrix.push_back(i);
+		SetFuzzyList(list);
 		return;
 	}
 
@@ -173,6 +295,7 @@ void AutoComplete::SetList(const char *list) {
 	if (autoSort == Ordering::Custom || sortMatrix.size() < 2) {
 		lb->SetList(list, separator, typesep);
 		PLATFORM_ASSERT(lb->Length() == static_cast<int>(sortMatrix.size()));
+		SetFuzzyList(list);
 		return;
 	}
 
@@ -200,6 +323,32 @@ void AutoComplete::SetList(const char *list) {
 	for (int i = 0; i < static_cast<int>(sortMatrix.size()); ++i)
 		sortMatrix[i] = i;
 	lb->SetList(sortedList.c_str(), separator, typesep);
+	SetFuzzyList(sortedList.c_str());
+}
+
+void AutoComplete::SetFuzzyList(const char *list) {
+	filtered = false;
+	rankedMatrix.clear();
+	fuzzyItems.clear();
+	fuzzyList.clear();
+	if (!FlagSet(options, AutoCompleteOption::Fuzzy))
+		return;
+	// Split the same way as the list box so the entries correspond to its rows
+	fuzzyList = list;
+	const std::string_view sv(fuzzyList);
+	size_t start = 0;
+	for (;;) {
+		size_t end = sv.find(separator, start);
+		if (end == std::string_view::npos)
+			end = sv.length();
+		const std::string_view entry = sv.substr(start, end - start);
+		const std::string_view word = entry.substr(0, entry.rfind(typesep));
+		fuzzyItems.push_back(FuzzyItem{ static_cast<int>(start), static_cast<int>(word.length()),
+			static_cast<int>(entry.length()), FuzzyMask(word) });
+		if (end >= sv.length())
+			break;
+		start = end + 1;
+	}
 }
 
 int AutoComplete::GetSelection() const {
@@ -221,6 +370,7 @@ void AutoComplete::Cancel() noexcept {
 		lb->Clear();
 		lb->Destroy();
 		active = false;
+		filtered = false;
 	}
 }
 
@@ -237,44 +387,33 @@ void AutoComplete::Move(int delta) {
 }
 
 void AutoComplete::Select(const char *word) {
+	if (!fuzzyItems.empty()) {
+		SelectFuzzy(word);
+		return;
+	}
 	const size_t lenWord = strlen(word);
+	const bool caseSensitive = !ignoreCase;
 	int location = -1;
 	int start = 0; // lower bound of the api array block to search
 	int end = lb->Length() - 1; // upper bound of the api array block to search
+	if ((previousEnd >= previousStart) && (previousEnd <= end) && !previousWord.empty() &&
+		(lenWord >= previousWord.length()) && (strncmp(word, previousWord.c_str(), previousWord.length()) == 0)) {
+		// Extending the previous word so matches can only be within its matches
+		start = previousStart;
+		end = previousEnd;
+	}
 	while ((start <= end) && (location == -1)) { // Binary searching loop
 		int pivot = (start + end) / 2;
-		std::string item = GetValue(sortMatrix[pivot]);
-		int cond;
-		if (ignoreCase)
-			cond = CompareNCaseInsensitive(word, item.c_str(), lenWord);
-		else
-			cond = strncmp(word, item.c_str(), lenWord);
+		int cond = CompareItem(word, lenWord, pivot, caseSensitive);
 		if (!cond) {
 			// Find first match
 			while (pivot > start) {
-				item = lb->GetValue(sortMatrix[pivot-1]);
-				if (ignoreCase)
-					cond = CompareNCaseInsensitive(word, item.c_str(), lenWord);
-				else
-					cond = strncmp(word, item.c_str(), lenWord);
+				cond = CompareItem(word, lenWord, pivot - 1, caseSensitive);
 				if (0 != cond)
 					break;
 				--pivot;
 			}
 			location = pivot;
-			if (ignoreCase
-				&& ignoreCaseBehaviour == CaseInsensitiveBehaviour::RespectCase) {
-				// Check for exact-case match
-				for (; pivot <= end; pivot++) {
-					item = lb->GetValue(sortMatrix[pivot]);
-					if (!strncmp(word, item.c_str(), lenWord)) {
-						location = pivot;
-						break;
-					}
-					if (CompareNCaseInsensitive(word, item.c_str(), lenWord))
-						break;
-				}
-			}
 		} else if (cond < 0) {
 			end = pivot - 1;
 		} else { // cond > 0
@@ -282,18 +421,40 @@ void AutoComplete::Select(const char *word) {
 		}
 	}
 	if (location == -1) {
+		ResetPrevious();
 		if (autoHide)
 			Cancel();
 		else
 			lb->Select(-1);
 	} else {
+		// Find the last match by binary search so the block can be reused for the next word
+		int low = location;
+		int high = end;
+		while (low < high) {
+			const int pivot = (low + high + 1) / 2;
+			if (CompareItem(word, lenWord, pivot, caseSensitive) == 0)
+				low = pivot;
+			else
+				high = pivot - 1;
+		}
+		end = low;
+		previousWord.assign(word, lenWord);
+		previousStart = location;
+		previousEnd = end;
+		if (ignoreCase
+			&& ignoreCaseBehaviour == CaseInsensitiveBehaviour::RespectCase) {
+			// Check for exact-case match
+			for (int pivot = location; pivot <= end; pivot++) {
+				if (!CompareItem(word, lenWord, pivot, true)) {
+					location = pivot;
+					break;
+				}
+			}
+		}
 		if (autoSort == Ordering::Custom) {
 			// Check for a logically earlier match
 			for (int i = location + 1; i <= end; ++i) {
-				std::string item = lb->GetValue(sortMatrix[i]);
-				if (CompareNCaseInsensitive(word, item.c_str(), lenWord))
-					break;
-				if (sortMatrix[i] < sortMatrix[location] && !strncmp(word, item.c_str(), lenWord))
+				if (sortMatrix[i] < sortMatrix[location] && !CompareItem(word, lenWord, i, true))
 					location = i;
 			}
 		}
@@ -301,3 +462,75 @@ void AutoComplete::Select(const char *word) {
 	}
 }
 
+void AutoComplete::SelectFuzzy(const char *word) {
+	const std::string_view query(word);
+	if (query.empty()) {
+		// Show the whole list again
+		ResetPrevious();
+		if (filtered) {
+			lb->SetList(fuzzyList.c_str(), separator, typesep);
+			filtered = false;
+		}
+		lb->Select(0);
+		return;
+	}
+
+	struct Match {
+		int score;
+		int item;
+	};
+	std::vector<Match> matches;
+	const std::uint64_t maskQuery = FuzzyMask(query);
+	const std::string_view sv(fuzzyList);
+	auto consider = [&](int item) {
+		const FuzzyItem &fi = fuzzyItems[item];
+		if ((fi.mask & maskQuery) != maskQuery)
+			return;
+		const int score = FuzzyScore(query, sv.substr(fi.start, fi.lengthWord));
+		if (score > fuzzyNoMatch)
+			matches.push_back(Match{ score, item });
+	};
+	if (filtered && !previousWord.empty() && (query.length() >= previousWord.length()) &&
+		(query.substr(0, previousWord.length()) == previousWord)) {
+		// Extending the previous word so matches can only be among its matches
+		for (const int item : rankedMatrix)
+			consider(item);
+	} else {
+		for (int item = 0; item < static_cast<int>(fuzzyItems.size()); item++)
+			consider(item);
+	}
+
+	if (matches.empty()) {
+		ResetPrevious();
+		if (autoHide)
+			Cancel();
+		else
+			lb->Select(-1);
+		return;
+	}
+
+	// Best score first then shorter entries then the list's own order
+	std::sort(matches.begin(), matches.end(), [this](const Match &a, const Match &b) noexcept {
+		if (a.score != b.score)
+			return a.score > b.score;
+		const int lengthA = fuzzyItems[a.item].lengthWord;
+		const int lengthB = fuzzyItems[b.item].lengthWord;
+		if (lengthA != lengthB)
+			return lengthA < lengthB;
+		return a.item < b.item;
+	});
+
+	rankedMatrix.clear();
+	std::string rankedList;
+	for (const Match &match : matches) {
+		const FuzzyItem &fi = fuzzyItems[match.item];
+		if (!rankedMatrix.empty())
+			rankedList.push_back(separator);
+		rankedList.append(sv.substr(fi.start, fi.lengthEntry));
+		rankedMatrix.push_back(match.item);
+	}
+	previousWord.assign(query);
+	lb->SetList(rankedList.c_str(), separator, typesep);
+	filtered = true;
+	lb->Select(0);
+}
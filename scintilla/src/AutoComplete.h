@@ -6,8 +6,10 @@
 // Copyright 1998-2003 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "Geometry.h"
 #include "Platform.h"
@@ -17,6 +19,16 @@
 
 namespace Scintilla::Internal {
 
+/// Score returned by FuzzyScore when the query is not a subsequence of the candidate.
+constexpr int fuzzyNoMatch = -1000000;
+
+/// Summarise the bytes in text as a 64-bit set so candidates missing any byte of a query can be rejected cheaply.
+SCINTILLA_EXPORT std::uint64_t FuzzyMask(std::string_view text) noexcept;
+
+/// Score how well query matches candidate as a case-insensitive subsequence, favouring consecutive characters
+/// and matches at word starts and camel-case humps. Higher is better.
+SCINTILLA_EXPORT int FuzzyScore(std::string_view query, std::string_view candidate);
+
 class SCINTILLA_EXPORT AutoComplete {
   bool active;
   std::string stopChars;
@@ -25,6 +37,29 @@ class SCINTILLA_EXPORT AutoComplete {
   char typesep; // Type separator
   enum { maxItemLen = 1000 };
   std::vector<int> sortMatrix;
+  /// Range of sortMatrix matching the previous word passed to Select so that
+  /// when the user types more characters only that range has to be searched.
+  std::string previousWord;
+  int previousStart;
+  int previousEnd;
+  void ResetPrevious() noexcept;
+  int CompareItem(const char *word, size_t lenWord, int index, bool caseSensitive) const;
+
+  /// For AutoCompleteOption::Fuzzy, every entry of the complete list in list box order so the list box can be
+  /// refilled with the ranked matches for each word.
+  struct FuzzyItem {
+    int start;
+    int lengthWord;
+    int lengthEntry;
+    std::uint64_t mask;
+  };
+  std::string fuzzyList;
+  std::vector<FuzzyItem> fuzzyItems;
+  /// Ranked view over the entries: the list box row shows fuzzyItems[rankedMatrix[row]].
+  std::vector<int> rankedMatrix;
+  bool filtered;
+  void SetFuzzyList(const char *list);
+  void SelectFuzzy(const char *word);
 
 public:
   bool ignoreCase;
@@ -49,6 +49,11 @@ struct CountWidths {
 	CountWidths operator-() const noexcept {
 		return CountWidths(-countBasePlane, -countOtherPlanes);
 	}
+	CountWidths &operator+=(CountWidths other) noexcept {
+		countBasePlane += other.countBasePlane;
+		countOtherPlanes += other.countOtherPlanes;
+		return *this;
+	}
 	Sci::Position WidthUTF32() const noexcept {
 		// All code points take one code unit in UTF-32.
 		return countBasePlane + countOtherPlanes;
@@ -81,6 +86,8 @@ public:
 	virtual Sci::Position LineStart(Sci::Line line) const noexcept = 0;
 	virtual void InsertCharacters(Sci::Line line, CountWidths delta) noexcept = 0;
 	virtual void SetLineCharactersWidth(Sci::Line line, CountWidths width) noexcept = 0;
+	virtual Sci::Line IndexLinesCounted() const noexcept = 0;
+	virtual void CountIndexLine(CountWidths width) noexcept = 0;
 	virtual Scintilla::LineCharacterIndexType LineCharacterIndex() const noexcept = 0;
 	virtual bool AllocateLineCharacterIndex(Scintilla::LineCharacterIndexType lineCharacterIndex, Sci::Line lines) = 0;
 	virtual bool ReleaseLineCharacterIndex(Scintilla::LineCharacterIndexType lineCharacterIndex) = 0;
@@ -150,6 +157,15 @@ public:
 			starts.InsertPartition(lineAsPos + l, lineStart + l);
 		}
 	}
+	void InsertEmptyLines(Sci::Line line, Sci::Line lines) {
+		// Insert lines that have not been counted yet as 0 characters wide
+		// so the starts stay ascending until they are counted.
+		const POS lineAsPos = line_cast(line);
+		const POS lineStart = starts.PositionFromPartition(lineAsPos);
+		for (POS l = 0; l < line_cast(lines); l++) {
+			starts.InsertPartition(lineAsPos + l, lineStart);
+		}
+	}
 };
 
 template <typename POS>
@@ -159,6 +175,9 @@ class LineVector : public ILineVector {
 	LineStartIndex<POS> startsUTF16;
 	LineStartIndex<POS> startsUTF32;
 	LineCharacterIndexType activeIndices;
+	// The character indices are counted on demand: lines before indexLinesCounted
+	// have their real widths and the widths of later lines are placeholders.
+	Sci::Line indexLinesCounted;
 
 	void SetActiveIndices() noexcept {
 		activeIndices =
@@ -166,6 +185,26 @@ class LineVector : public ILineVector {
 			| (startsUTF16.Active() ? LineCharacterIndexType::Utf16 : LineCharacterIndexType::None);
 	}
 
+	void InsertIndexLines(Sci::Line line, Sci::Line lines) {
+		if (line < indexLinesCounted) {
+			// Inside the counted lines so the caller measures the changed lines
+			if (FlagSet(activeIndices, LineCharacterIndexType::Utf32)) {
+				startsUTF32.InsertLines(line, lines);
+			}
+			if (FlagSet(activeIndices, LineCharacterIndexType::Utf16)) {
+				startsUTF16.InsertLines(line, lines);
+			}
+			indexLinesCounted += lines;
+		} else {
+			if (FlagSet(activeIndices, LineCharacterIndexType::Utf32)) {
+				startsUTF32.InsertEmptyLines(line, lines);
+			}
+			if (FlagSet(activeIndices, LineCharacterIndexType::Utf16)) {
+				startsUTF16.InsertEmptyLines(line, lines);
+			}
+		}
+	}
+
 	// pos_cast(): cast Sci::Line and Sci::Position to either 32-bit or 64-bit value
 	// This avoids warnings from Visual C++ Code Analysis and shortens code
 	static constexpr POS pos_cast(Sci::Position pos) noexcept {
@@ -179,7 +218,7 @@ class LineVector : public ILineVector {
 	}
 
 public:
-	LineVector() : starts(256), perLine(nullptr), activeIndices(LineCharacterIndexType::None) {
+	LineVector() : starts(256), perLine(nullptr), activeIndices(LineCharacterIndexType::None), indexLinesCounted(0) {
 	}
 	void Init() override {
 		starts.DeleteAll();
@@ -188,6 +227,7 @@ public:
 		}
 		startsUTF32.starts.DeleteAll();
 		startsUTF16.starts.DeleteAll();
+		indexLinesCounted = 0;
 	}
 	void SetPerLine(PerLine *pl) noexcept override {
 		perLine = pl;
@@ -199,12 +239,7 @@ public:
 		const POS lineAsPos = pos_cast(line);
 		starts.InsertPartition(lineAsPos, pos_cast(position));
 		if (activeIndices != LineCharacterIndexType::None) {
-			if (FlagSet(activeIndices, LineCharacterIndexType::Utf32)) {
-				startsUTF32.InsertLines(line, 1);
-			}
-			if (FlagSet(activeIndices, LineCharacterIndexType::Utf16)) {
-				startsUTF16.InsertLines(line, 1);
-			}
+			InsertIndexLines(line, 1);
 		}
 		if (perLine) {
 			if ((line > 0) && lineStart)
@@ -223,12 +258,7 @@ public:
       starts.InsertPartitionsWithCast(lineAsPos, positions, lines);
     }
     if (activeIndices != LineCharacterIndexType::None) {
-      if (FlagSet(activeIndices, LineCharacterIndexType::Utf32)) {
-        startsUTF32.InsertLines(line, lines);
-      }
-      if (FlagSet(activeIndices, LineCharacterIndexType::Utf16)) {
-        startsUTF16.InsertLines(line, lines);
-      }
+      InsertIndexLines(line, lines);
     }
     if (perLine) {
       if ((line > 0) && lineStart) line--;
@@ -246,6 +276,12 @@ public:
     if (FlagSet(activeIndices, LineCharacterIndexType::Utf16)) {
       startsUTF16.starts.RemovePartition(pos_cast(line));
     }
+    if (line < indexLinesCounted) {
+      indexLinesCounted--;
+    } else if (line == indexLinesCounted) {
+      // Last counted line absorbed an uncounted line so its width is unknown
+      indexLinesCounted = line - 1;
+    }
     if (perLine) {
 			perLine->RemoveLine(line);
 		}
@@ -269,6 +305,9 @@ public:
 		return starts.PositionFromPartition(pos_cast(line));
 	}
 	void InsertCharacters(Sci::Line line, CountWidths delta) noexcept override {
+		if (line >= indexLinesCounted) {
+			return;
+		}
 		if (FlagSet(activeIndices, LineCharacterIndexType::Utf32)) {
 			startsUTF32.starts.InsertText(pos_cast(line), pos_cast(delta.WidthUTF32()));
 		}
@@ -277,6 +316,9 @@ public:
 		}
 	}
 	void SetLineCharactersWidth(Sci::Line line, CountWidths width) noexcept override {
+		if (line >= indexLinesCounted) {
+			return;
+		}
 		if (FlagSet(activeIndices, LineCharacterIndexType::Utf32)) {
 			assert(startsUTF32.starts.Partitions() == starts.Partitions());
 			startsUTF32.SetLineWidth(line, width.WidthUTF32());
@@ -286,6 +328,13 @@ public:
 			startsUTF16.SetLineWidth(line, width.WidthUTF16());
 		}
 	}
+	Sci::Line IndexLinesCounted() const noexcept override {
+		return indexLinesCounted;
+	}
+	void CountIndexLine(CountWidths width) noexcept override {
+		indexLinesCounted++;
+		SetLineCharactersWidth(indexLinesCounted - 1, width);
+	}
 
 	LineCharacterIndexType LineCharacterIndex() const noexcept override {
 		return activeIndices;
@@ -301,7 +350,12 @@ public:
 			assert(startsUTF16.starts.Partitions() == starts.Partitions());
 		}
 		SetActiveIndices();
-		return activeIndicesStart != activeIndices;
+		if (activeIndicesStart != activeIndices) {
+			// All active indices are counted together so start again
+			indexLinesCounted = 0;
+			return true;
+		}
+		return false;
 	}
 	bool ReleaseLineCharacterIndex(LineCharacterIndexType lineCharacterIndex) override {
 		const LineCharacterIndexType activeIndicesStart = activeIndices;
@@ -545,10 +599,8 @@ LineCharacterIndexType CellBuffer::LineCharacterIndex() const noexcept {
 
 void CellBuffer::AllocateLineCharacterIndex(LineCharacterIndexType lineCharacterIndex) {
 	if (utf8Substance) {
-		if (plv->AllocateLineCharacterIndex(lineCharacterIndex, Lines())) {
-			// Changed so recalculate whole file
-			RecalculateIndexLineStarts(0, Lines() - 1);
-		}
+		// Lines are counted when the index is first queried
+		plv->AllocateLineCharacterIndex(lineCharacterIndex, Lines());
 	}
 }
 
@@ -605,10 +657,21 @@ Sci::Line CellBuffer::LineFromPosition(Sci::Position pos) const noexcept {
 }
 
 Sci::Position CellBuffer::IndexLineStart(Sci::Line line, LineCharacterIndexType lineCharacterIndex) const noexcept {
+	if (MaintainingLineCharacterIndex() && (line > plv->IndexLinesCounted())) {
+		// The start of a line depends only on the lines before it
+		CountIndexLines(line);
+	}
 	return plv->IndexLineStart(line, lineCharacterIndex);
 }
 
 Sci::Line CellBuffer::LineFromPositionIndex(Sci::Position pos, LineCharacterIndexType lineCharacterIndex) const noexcept {
+	if (MaintainingLineCharacterIndex()) {
+		Sci::Line linesCounted = plv->IndexLinesCounted();
+		while ((linesCounted < Lines()) && (plv->IndexLineStart(linesCounted, lineCharacterIndex) <= pos)) {
+			CountIndexLines(linesCounted + 1);
+			linesCounted = plv->IndexLinesCounted();
+		}
+	}
 	return plv->LineFromPositionIndex(pos, lineCharacterIndex);
 }
 
@@ -749,6 +812,21 @@ CountWidths CountCharacterWidthsUTF8(std::string_view sv) noexcept {
 	CountWidths cw;
 	size_t remaining = sv.length();
 	while (remaining > 0) {
+		// Most text is ASCII so skip over runs of it a word at a time
+		constexpr uint64_t highBits = 0x8080808080808080ULL;
+		uint64_t word = 0;
+		while (remaining >= sizeof(word)) {
+			memcpy(&word, sv.data(), sizeof(word));
+			if (word & highBits) {
+				break;
+			}
+			cw.countBasePlane += sizeof(word);
+			sv.remove_prefix(sizeof(word));
+			remaining -= sizeof(word);
+		}
+		if (remaining == 0) {
+			break;
+		}
 		const int utf8Status = UTF8Classify(sv);
 		const int lenChar = utf8Status & UTF8MaskWidth;
 		cw.CountChar(lenChar);
@@ -758,6 +836,44 @@ CountWidths CountCharacterWidthsUTF8(std::string_view sv) noexcept {
 	return cw;
 }
 
+// Count the characters in a range of the buffer without copying it, even when the range
+// is split by the gap.
+CountWidths CountCharacterWidthsUTF8(const SplitView &view, size_t start, size_t end) noexcept {
+	if (end <= view.length1) {
+		return CountCharacterWidthsUTF8(std::string_view(view.segment1 + start, end - start));
+	}
+	if (start >= view.length1) {
+		return CountCharacterWidthsUTF8(std::string_view(view.segment2 + start, end - start));
+	}
+	CountWidths cw;
+	std::string_view sv(view.segment1 + start, view.length1 - start);
+	while (sv.length() >= UTF8MaxBytes) {
+		const int lenChar = UTF8Classify(sv) & UTF8MaskWidth;
+		cw.CountChar(lenChar);
+		sv.remove_prefix(lenChar);
+	}
+	// Characters starting in the last few bytes before the gap may continue after it
+	// so classify them in a joined copy.
+	char joined[UTF8MaxBytes * 2]{};
+	const size_t before = sv.length();
+	const size_t after = std::min<size_t>(UTF8MaxBytes, end - view.length1);
+	memcpy(joined, sv.data(), before);
+	memcpy(joined + before, view.segment2 + view.length1, after);
+	std::string_view svJoined(joined, before + after);
+	while (svJoined.length() > after) {
+		const int lenChar = UTF8Classify(svJoined) & UTF8MaskWidth;
+		cw.CountChar(lenChar);
+		svJoined.remove_prefix(lenChar);
+	}
+	const size_t resume = view.length1 + after - svJoined.length();
+	cw += CountCharacterWidthsUTF8(std::string_view(view.segment2 + resume, end - resume));
+	return cw;
+}
+
+// Count lines in blocks so a run of queries moving through the document only
+// occasionally counts more lines.
+constexpr Sci::Line indexBlockLines = 1024;
+
 }
 
 bool CellBuffer::MaintainingLineCharacterIndex() const noexcept {
@@ -765,20 +881,33 @@ bool CellBuffer::MaintainingLineCharacterIndex() const noexcept {
 }
 
 void CellBuffer::RecalculateIndexLineStarts(Sci::Line lineFirst, Sci::Line lineLast) {
-	std::string text;
+	// Lines that have not been counted yet are left for CountIndexLines
+	lineLast = std::min(lineLast, plv->IndexLinesCounted() - 1);
+	const SplitView view = AllView();
 	Sci::Position posLineEnd = LineStart(lineFirst);
 	for (Sci::Line line = lineFirst; line <= lineLast; line++) {
-		// Find line start and end, retrieve text of line, count characters and update line width
+		// Find line start and end, count characters and update line width
 		const Sci::Position posLineStart = posLineEnd;
 		posLineEnd = LineStart(line+1);
-		const Sci::Position width = posLineEnd - posLineStart;
-		text.resize(width);
-		GetCharRange(text.data(), posLineStart, width);
-		const CountWidths cw = CountCharacterWidthsUTF8(text);
+		const CountWidths cw = CountCharacterWidthsUTF8(view, posLineStart, posLineEnd);
 		plv->SetLineCharactersWidth(line, cw);
 	}
 }
 
+void CellBuffer::CountIndexLines(Sci::Line lines) const noexcept {
+	// Counting extends a cache of the text so is allowed in const queries
+	const Sci::Line linesWanted = std::min(
+		(lines + indexBlockLines - 1) / indexBlockLines * indexBlockLines, Lines());
+	const SplitView view = AllView();
+	Sci::Line line = plv->IndexLinesCounted();
+	Sci::Position posLineEnd = LineStart(line);
+	for (; line < linesWanted; line++) {
+		const Sci::Position posLineStart = posLineEnd;
+		posLineEnd = LineStart(line+1);
+		plv->CountIndexLine(CountCharacterWidthsUTF8(view, posLineStart, posLineEnd));
+	}
+}
+
 void CellBuffer::BasicInsertString(Sci::Position position, const char *s, Sci::Position insertLength) {
 	if (insertLength == 0)
 		return;
@@ -1078,6 +1207,18 @@ void CellBuffer::DeleteUndoHistory() noexcept {
 	uh->DeleteUndoHistory();
 }
 
+void CellBuffer::SetUndoMemoryLimit(size_t limit) {
+	uh->SetMemoryLimit(limit);
+}
+
+size_t CellBuffer::UndoMemoryLimit() const noexcept {
+	return uh->MemoryLimit();
+}
+
+size_t CellBuffer::UndoMemory() const noexcept {
+	return uh->MemoryUse();
+}
+
 bool CellBuffer::CanUndo() const noexcept {
 	return uh->CanUndo();
 }
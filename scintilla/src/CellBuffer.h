@@ -95,6 +95,7 @@ private:
   bool UTF8IsCharacterBoundary(Sci::Position position) const;
   void ResetLineEnds();
   void RecalculateIndexLineStarts(Sci::Line lineFirst, Sci::Line lineLast);
+  void CountIndexLines(Sci::Line lines) const noexcept;
   bool MaintainingLineCharacterIndex() const noexcept;
   /// Actions without undo
   void BasicInsertString(Sci::Position position, const char *s, Sci::Position insertLength);
@@ -170,6 +171,9 @@ public:
   void EndUndoAction() noexcept;
   void AddUndoAction(Sci::Position token, bool mayCoalesce);
   void DeleteUndoHistory() noexcept;
+  void SetUndoMemoryLimit(size_t limit);
+  size_t UndoMemoryLimit() const noexcept;
+  size_t UndoMemory() const noexcept;
 
   /// To perform an undo, StartUndo is called to retrieve the number of steps, then UndoStep is
   /// called that many times. Similarly for redo.
@@ -9,6 +9,7 @@
 #include <cstring>
 #include <cstdio>
 #include <cstdarg>
+#include <cstdint>
 
 #include <stdexcept>
 #include <string_view>
@@ -18,6 +19,7 @@
 #include <memory>
 
 #include "ScintillaTypes.h"
+#include "ScintillaStructures.h"
 
 #include "Debugging.h"
 
@@ -65,6 +67,14 @@ public:
 	Sci::Position EndRun(Sci::Position position) const noexcept override {
 		return rs.EndRun(pos_cast(position));
 	}
+	bool OnInRange(Sci::Position start, Sci::Position end) const noexcept override {
+		end = std::min(end, Length());
+		if (start >= end) {
+			return false;
+		}
+		// Adjacent runs always differ so a run starting inside the range means one of them is on
+		return rs.ValueAt(pos_cast(start)) || (rs.EndRun(pos_cast(start)) < end);
+	}
 	void SetValueAt(Sci::Position position, int value) override {
 		rs.SetValueAt(pos_cast(position), value);
 	}
@@ -115,6 +125,7 @@ public:
 
 	// Returns changed=true if some values may have changed
 	FillResult<Sci::Position> FillRange(Sci::Position position, int value, Sci::Position fillLength) override;
+	FillResult<Sci::Position> FillRanges(const Scintilla::IndicatorFill *fills, size_t count) override;
 
 	void InsertSpace(Sci::Position position, Sci::Position insertLength) override;
 	void DeleteRange(Sci::Position position, Sci::Position deleteLength) override;
@@ -122,6 +133,7 @@ public:
 	void DeleteLexerDecorations() override;
 
 	int AllOnFor(Sci::Position position) const noexcept override;
+	uint64_t AllOnInRange(Sci::Position start, Sci::Position end) const noexcept override;
 	int ValueAt(int indicator, Sci::Position position) noexcept override;
 	Sci::Position Start(int indicator, Sci::Position position) noexcept override;
 	Sci::Position End(int indicator, Sci::Position position) noexcept override;
@@ -207,6 +219,22 @@ FillResult<Sci::Position> DecorationList<POS>::FillRange(Sci::Position position,
 	return fr;
 }
 
+template <typename POS>
+FillResult<Sci::Position> DecorationList<POS>::FillRanges(const Scintilla::IndicatorFill *fills, size_t count) {
+	if (!current) {
+		current = DecorationFromIndicator(currentIndicator);
+		if (!current) {
+			current = Create(currentIndicator, lengthDocument);
+		}
+	}
+	const FillResult<POS> frInPOS = current->rs.FillRanges(fills, count);
+	const FillResult<Sci::Position> fr { frInPOS.changed, frInPOS.position, frInPOS.fillLength };
+	if (current->Empty()) {
+		Delete(currentIndicator);
+	}
+	return fr;
+}
+
 template <typename POS>
 void DecorationList<POS>::InsertSpace(Sci::Position position, Sci::Position insertLength) {
 	const bool atEnd = position == lengthDocument;
@@ -276,6 +304,19 @@ int DecorationList<POS>::AllOnFor(Sci::Position position) const noexcept {
 	return mask;
 }
 
+template <typename POS>
+uint64_t DecorationList<POS>::AllOnInRange(Sci::Position start, Sci::Position end) const noexcept {
+	static_assert(Scintilla::IndicatorMax < 64);
+	uint64_t mask = 0;
+	for (const std::unique_ptr<Decoration<POS>> &deco : decorationList) {
+		const int indicator = deco->Indicator();
+		if ((indicator >= 0) && (indicator <= Scintilla::IndicatorMax) && deco->OnInRange(start, end)) {
+			mask |= 1ull << indicator;
+		}
+	}
+	return mask;
+}
+
 template <typename POS>
 int DecorationList<POS>::ValueAt(int indicator, Sci::Position position) noexcept {
 	const Decoration<POS> *deco = DecorationFromIndicator(indicator);
@@ -5,12 +5,17 @@
 // Copyright 1998-2007 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include "Position.h"
 #include "RunStyles.h"
 #include "scintilla_globals.h"
 
+namespace Scintilla {
+struct IndicatorFill; // Declare in case ScintillaStructures.h not included
+}
+
 namespace Scintilla::Internal {
 
 class SCINTILLA_EXPORT IDecoration {
@@ -22,6 +27,8 @@ public:
   virtual int ValueAt(Sci::Position position) const noexcept = 0;
   virtual Sci::Position StartRun(Sci::Position position) const noexcept = 0;
   virtual Sci::Position EndRun(Sci::Position position) const noexcept = 0;
+  // True when some position in [start, end) has a non-zero value
+  virtual bool OnInRange(Sci::Position start, Sci::Position end) const noexcept = 0;
   virtual void SetValueAt(Sci::Position position, int value) = 0;
   virtual void InsertSpace(Sci::Position position, Sci::Position insertLength) = 0;
   virtual Sci::Position Runs() const noexcept = 0;
@@ -41,11 +48,16 @@ public:
 
   // Returns with changed=true if some values may have changed
   virtual FillResult<Sci::Position> FillRange(Sci::Position position, int value, Sci::Position fillLength) = 0;
+  // Fills the current indicator over ranges sorted by position, each with its own value
+  virtual FillResult<Sci::Position> FillRanges(const IndicatorFill *fills, size_t count) = 0;
   virtual void InsertSpace(Sci::Position position, Sci::Position insertLength) = 0;
   virtual void DeleteRange(Sci::Position position, Sci::Position deleteLength) = 0;
   virtual void DeleteLexerDecorations() = 0;
 
   virtual int AllOnFor(Sci::Position position) const noexcept = 0;
+  // Bit for each indicator, including IME and history indicators, with a non-zero value in [start, end).
+  // Drawing queries this once per line and skips the decorations that are not present.
+  virtual uint64_t AllOnInRange(Sci::Position start, Sci::Position end) const noexcept = 0;
   virtual int ValueAt(int indicator, Sci::Position position) noexcept = 0;
   virtual Sci::Position Start(int indicator, Sci::Position position) noexcept = 0;
   virtual Sci::Position End(int indicator, Sci::Position position) noexcept = 0;
@@ -54,6 +66,11 @@ public:
   virtual void SetClickNotified(bool notified) noexcept = 0;
 };
 
+// Test an indicator's bit in a mask from IDecorationList::AllOnInRange
+constexpr bool IndicatorInMask(uint64_t mask, int indicator) noexcept {
+  return (indicator >= 0) && (indicator < 64) && (mask & (1ull << indicator));
+}
+
 SCINTILLA_EXPORT std::unique_ptr<IDecoration> DecorationCreate(bool largeDocument, int indicator);
 
 SCINTILLA_EXPORT std::unique_ptr<IDecorationList> DecorationListCreate(bool largeDocument);
@@ -155,6 +155,7 @@ Document::Document(DocumentOption options) :
 	dbcsCodePage = CpUtf8;
 	lineEndBitSet = LineEndType::Default;
 	endStyled = 0;
+	bytesStyled = 0;
 	styleClock = 0;
 	enteredModification = 0;
 	enteredStyling = 0;
@@ -444,6 +445,10 @@ Sci::Line Document::MarkerNext(Sci::Line lineStart, int mask) const noexcept {
 	return Markers()->MarkerNext(lineStart, mask);
 }
 
+Sci::Line Document::MarkerPrevious(Sci::Line lineStart, int mask) const noexcept {
+	return Markers()->MarkerPrevious(lineStart, mask);
+}
+
 int Document::AddMark(Sci::Line line, int markerNum) {
 	if (line >= 0 && line < LinesTotal()) {
 		const int prev = Markers()->AddMark(line, markerNum, LinesTotal());
@@ -482,11 +487,7 @@ void Document::DeleteMarkFromHandle(int markerHandle) {
 }
 
 void Document::DeleteAllMarks(int markerNum) {
-	bool someChanges = false;
-	for (Sci::Line line = 0; line < LinesTotal(); line++) {
-		if (Markers()->DeleteMark(line, markerNum, true))
-			someChanges = true;
-	}
+	const bool someChanges = Markers()->DeleteAllMarks(markerNum);
 	if (someChanges) {
 		DocModification mh(ModificationFlags::ChangeMarker);
 		mh.line = -1;
@@ -1389,6 +1390,113 @@ Sci::Position Document::InsertString(Sci::Position position, std::string_view sv
 	return InsertString(position, sv.data(), sv.length());
 }
 
+/**
+ * Apply a sorted set of non-overlapping replacements as one modification.
+ * Elements are applied from the end backwards so the positions of earlier elements stay valid
+ * and the buffer gap sweeps the affected span once. The edit forms a single undo group.
+ * Watchers are notified of each element separately so unchanged text between elements is not
+ * reported as deleted and inserted.
+ */
+bool Document::ReplaceRanges(std::vector<Replacement> &replacements) {
+	if (replacements.empty())
+		return false;
+	Sci::Position spanEnd = 0;
+	for (const Replacement &replacement : replacements) {
+		if ((replacement.position < spanEnd) || (replacement.lengthDelete < 0))
+			return false;
+		spanEnd = replacement.position + replacement.lengthDelete;
+	}
+	if (spanEnd > LengthNoExcept())
+		return false;
+	CheckReadOnly();	// Application may change read only state here
+	if (cb.IsReadOnly()) {
+		return false;
+	}
+	if (enteredModification != 0) {
+		return false;
+	}
+	enteredModification++;
+
+	// Each inserted text may be changed by the application through ChangeInsertion.
+	// Reserve so views into changedTexts are not invalidated by reallocation.
+	std::vector<std::string_view> texts;
+	texts.reserve(replacements.size());
+	std::vector<std::string> changedTexts;
+	changedTexts.reserve(replacements.size());
+	for (Replacement &replacement : replacements) {
+		std::string_view text = replacement.text;
+		if (!text.empty()) {
+			insertionSet = false;
+			insertion.clear();
+			NotifyModified(
+				DocModification(
+					ModificationFlags::InsertCheck,
+					replacement.position, text.length(),
+					0, text.data()));
+			if (insertionSet) {
+				changedTexts.push_back(insertion);
+				text = changedTexts.back();
+			}
+		}
+		replacement.lengthInserted = text.length();
+		texts.push_back(text);
+	}
+	if (insertionSet) {	// Free memory as could be large
+		std::string().swap(insertion);
+	}
+
+	const bool startSavePoint = cb.IsSavePoint();
+	cb.BeginUndoAction();
+	for (size_t i = replacements.size(); i-- > 0;) {
+		const Sci::Position position = replacements[i].position;
+		const Sci::Position lengthDelete = replacements[i].lengthDelete;
+		if (lengthDelete > 0) {
+			NotifyModified(
+				DocModification(
+					ModificationFlags::BeforeDelete | ModificationFlags::User,
+					position, lengthDelete,
+					0, nullptr));
+			const Sci::Line prevLinesTotal = LinesTotal();
+			bool startSequence = false;
+			const char *text = cb.DeleteChars(position, lengthDelete, startSequence);
+			if ((position < LengthNoExcept()) || (position == 0))
+				ModifiedAt(position);
+			else
+				ModifiedAt(position-1);
+			NotifyModified(
+				DocModification(
+					ModificationFlags::DeleteText | ModificationFlags::User |
+					(startSequence?ModificationFlags::StartAction:ModificationFlags::None),
+					position, lengthDelete,
+					LinesTotal() - prevLinesTotal, text));
+		}
+		const std::string_view textInsert = texts[i];
+		if (!textInsert.empty()) {
+			const Sci::Position insertLength = textInsert.length();
+			NotifyModified(
+				DocModification(
+					ModificationFlags::BeforeInsert | ModificationFlags::User,
+					position, insertLength,
+					0, textInsert.data()));
+			const Sci::Line prevLinesTotal = LinesTotal();
+			bool startSequence = false;
+			const char *text = cb.InsertString(position, textInsert.data(), insertLength, startSequence);
+			ModifiedAt(position);
+			NotifyModified(
+				DocModification(
+					ModificationFlags::InsertText | ModificationFlags::User |
+					(startSequence?ModificationFlags::StartAction:ModificationFlags::None),
+					position, insertLength,
+					LinesTotal() - prevLinesTotal, text));
+		}
+	}
+	cb.EndUndoAction();
+	if (startSavePoint && cb.IsCollectingUndo())
+		NotifySavePoint(false);
+	enteredModification--;
+	return true;
+}
+
 void Document::ChangeInsertion(const char *s, Sci::Position length) {
 	insertionSet = true;
 	insertion.assign(s, length);
@@ -1740,6 +1848,70 @@ std::string Document::TransformLineEnds(const char *s, size_t len, EndOfLine eol
 	return dest;
 }
 
+bool Document::WriteText(TextWriter &writer, size_t chunkSize, std::optional<EndOfLine> eolWanted) const {
+	const SplitView view = cb.AllView();
+	// Room for CR LF
+	chunkSize = std::max<size_t>(chunkSize, 2);
+	if (!eolWanted) {
+		// Pieces do not span the gap so each is contiguous and written without copying
+		for (size_t position = 0; position < view.length;) {
+			const bool first = position < view.length1;
+			const char *segment = first ? view.segment1 : view.segment2;
+			const size_t segmentEnd = first ? view.length1 : view.length;
+			const size_t lengthPiece = std::min(chunkSize, segmentEnd - position);
+			if (!writer.Write(std::string_view(segment + position, lengthPiece))) {
+				return false;
+			}
+			position += lengthPiece;
+		}
+		return true;
+	}
+
+	const std::string_view eol = (*eolWanted == EndOfLine::CrLf) ? "\r\n" :
+		((*eolWanted == EndOfLine::Cr) ? "\r" : "\n");
+	std::string buffer;
+	buffer.reserve(chunkSize);
+	const auto append = [&buffer, &writer, chunkSize](std::string_view text) -> bool {
+		while (!text.empty()) {
+			if (buffer.length() == chunkSize) {
+				if (!writer.Write(buffer)) {
+					return false;
+				}
+				buffer.clear();
+			}
+			const size_t lengthAppend = std::min(text.length(), chunkSize - buffer.length());
+			buffer.append(text.substr(0, lengthAppend));
+			text.remove_prefix(lengthAppend);
+		}
+		return true;
+	};
+	for (size_t position = 0; position < view.length;) {
+		const bool first = position < view.length1;
+		const char *segment = first ? view.segment1 : view.segment2;
+		const size_t segmentEnd = first ? view.length1 : view.length;
+		const char *lineEnd = std::find_if(segment + position, segment + segmentEnd, [](char ch) noexcept {
+			return (ch == '\r') || (ch == '\n');
+		});
+		const size_t lengthText = lineEnd - (segment + position);
+		if (!append(std::string_view(segment + position, lengthText))) {
+			return false;
+		}
+		position += lengthText;
+		if (position < segmentEnd) {
+			// CR LF may be split over the gap so use CharAt to see following byte
+			position += ((*lineEnd == '\r') && (view.CharAt(position + 1) == '\n')) ? 2 : 1;
+			if (buffer.length() + eol.length() > chunkSize) {
+				if (!writer.Write(buffer)) {
+					return false;
+				}
+				buffer.clear();
+			}
+			buffer.append(eol);
+		}
+	}
+	return buffer.empty() || writer.Write(buffer);
+}
+
 void Document::ConvertLineEnds(EndOfLine eolModeSet) {
 	UndoGroup ug(this);
 
@@ -2456,6 +2628,7 @@ bool SCI_METHOD Document::SetStyles(Sci_Position length, const char *styles) {
 void Document::EnsureStyledTo(Sci::Position pos) {
 	if ((enteredStyling == 0) && (pos > GetEndStyled())) {
 		IncrementStyleClock();
+		const Sci::Position endStyledBefore = GetEndStyled();
 		if (pli && !pli->UseContainerLexing()) {
 			const Sci::Position endStyledTo = LineStartPosition(GetEndStyled());
 			pli->Colourise(endStyledTo, pos);
@@ -2466,6 +2639,9 @@ void Document::EnsureStyledTo(Sci::Position pos) {
 				it->watcher->NotifyStyleNeeded(this, it->userData, pos);
 			}
 		}
+		if (GetEndStyled() > endStyledBefore) {
+			bytesStyled += GetEndStyled() - endStyledBefore;
+		}
 	}
 }
 
@@ -2642,6 +2818,16 @@ void SCI_METHOD Document::DecorationFillRange(Sci_Position position, int value,
 	}
 }
 
+void Document::DecorationFillRanges(const IndicatorFill *fills, size_t count) {
+	// One notification for the whole set avoids a redraw per range
+	const FillResult<Sci::Position> fr = decorations->FillRanges(fills, count);
+	if (fr.changed) {
+		const DocModification mh(ModificationFlags::ChangeIndicator | ModificationFlags::User,
+							fr.position, fr.fillLength);
+		NotifyModified(mh);
+	}
+}
+
 bool Document::AddWatcher(DocWatcher *watcher, void *userData) {
 	const WatcherWithUserData wwud(watcher, userData);
 	std::vector<WatcherWithUserData>::iterator it =
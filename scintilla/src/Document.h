@@ -241,10 +241,35 @@ struct SCINTILLA_EXPORT CharacterExtracted {
   }
 };
 
+/**
+ * One element of a batched edit: replace lengthDelete bytes at position with text.
+ * Positions are in terms of the document before any element of the batch is applied.
+ * lengthInserted is set when applied as the application may change the inserted text.
+ */
+struct SCINTILLA_EXPORT Replacement {
+  Sci::Position position;
+  Sci::Position lengthDelete;
+  std::string_view text;
+  Sci::Position lengthInserted;
+
+  Replacement(Sci::Position position_, Sci::Position lengthDelete_, std::string_view text_) noexcept
+      : position(position_), lengthDelete(lengthDelete_), text(text_), lengthInserted(0) {}
+};
+
+/**
+ * Receives the text of a document in pieces from Document::WriteText.
+ */
+class SCINTILLA_EXPORT TextWriter {
+public:
+  virtual ~TextWriter() {}
+  // Return false to stop writing, such as after a device error
+  virtual bool Write(std::string_view text) = 0;
+};
+
 /**
  */
 class SCINTILLA_EXPORT Document : PerLine,
-                                  public Scintilla::IDocument,
+                                  public Scintilla::IDocumentRange,
                                   public Scintilla::ILoader,
                                   public Scintilla::IDocumentEditable {
 
@@ -267,6 +292,7 @@ private:
   CharacterCategoryMap charMap;
   std::unique_ptr<CaseFolder> pcf;
   Sci::Position endStyled;
+  Sci::Position bytesStyled;
   int styleClock;
   int enteredModification;
   int enteredStyling;
@@ -329,7 +355,7 @@ public:
   bool SetLineEndTypesAllowed(Scintilla::LineEndType lineEndBitSet_);
   Scintilla::LineEndType GetLineEndTypesActive() const noexcept { return cb.GetLineEndTypes(); }
 
-  int SCI_METHOD Version() const override { return Scintilla::dvRelease4; }
+  int SCI_METHOD Version() const override { return Scintilla::dvRelease5; }
   int SCI_METHOD DEVersion() const noexcept override;
 
   void SCI_METHOD SetErrorStatus(int status) override;
@@ -366,6 +392,7 @@ public:
   bool DeleteChars(Sci::Position pos, Sci::Position len);
   Sci::Position InsertString(Sci::Position position, const char *s, Sci::Position insertLength);
   Sci::Position InsertString(Sci::Position position, std::string_view sv);
+  bool ReplaceRanges(std::vector<Replacement> &replacements);
   void ChangeInsertion(const char *s, Sci::Position length);
   int SCI_METHOD AddData(const char *data, Sci_Position length) override;
   IDocumentEditable *AsDocumentEditable() noexcept;
@@ -380,6 +407,9 @@ public:
   void BeginUndoAction(bool coalesceWithPrior = false) noexcept { cb.BeginUndoAction(coalesceWithPrior); }
   void EndUndoAction() noexcept { cb.EndUndoAction(); }
   void AddUndoAction(Sci::Position token, bool mayCoalesce) { cb.AddUndoAction(token, mayCoalesce); }
+  void SetUndoMemoryLimit(size_t limit) { cb.SetUndoMemoryLimit(limit); }
+  size_t UndoMemoryLimit() const noexcept { return cb.UndoMemoryLimit(); }
+  size_t UndoMemory() const noexcept { return cb.UndoMemory(); }
   void SetSavePoint();
   bool IsSavePoint() const noexcept { return cb.IsSavePoint(); }
 
@@ -410,10 +440,10 @@ public:
   [[nodiscard]] Sci::Position EditionNextDelete(Sci::Position pos) const noexcept { return cb.EditionNextDelete(pos); }
 
   const char *SCI_METHOD BufferPointer() override { return cb.BufferPointer(); }
-  const char *RangePointer(Sci::Position position, Sci::Position rangeLength) noexcept {
+  const char *SCI_METHOD RangePointer(Sci::Position position, Sci::Position rangeLength) noexcept override {
     return cb.RangePointer(position, rangeLength);
   }
-  Sci::Position GapPosition() const noexcept { return cb.GapPosition(); }
+  Sci::Position SCI_METHOD GapPosition() const noexcept override { return cb.GapPosition(); }
 
   int SCI_METHOD GetLineIndentation(Sci_Position line) override;
   Sci::Position SetLineIndentation(Sci::Line line, Sci::Position indent);
@@ -425,6 +455,9 @@ public:
   void Indent(bool forwards, Sci::Line lineBottom, Sci::Line lineTop);
   static std::string TransformLineEnds(const char *s, size_t len, Scintilla::EndOfLine eolModeWanted);
   void ConvertLineEnds(Scintilla::EndOfLine eolModeSet);
+  // Pass the whole text to writer in pieces of at most chunkSize bytes, converting line ends if eolWanted set.
+  // Reads the buffer in place so may be called from another thread while the text is not being modified.
+  bool WriteText(TextWriter &writer, size_t chunkSize, std::optional<Scintilla::EndOfLine> eolWanted) const;
   std::string_view EOLString() const noexcept;
   void SetReadOnly(bool set) noexcept { cb.SetReadOnly(set); }
   bool IsReadOnly() const noexcept { return cb.IsReadOnly(); }
@@ -446,6 +479,7 @@ public:
   }
   int GetMark(Sci::Line line, bool includeChangeHistory) const;
   Sci::Line MarkerNext(Sci::Line lineStart, int mask) const noexcept;
+  Sci::Line MarkerPrevious(Sci::Line lineStart, int mask) const noexcept;
   int AddMark(Sci::Line line, int markerNum);
   void AddMarkSet(Sci::Line line, int valueSet);
   void DeleteMark(Sci::Line line, int markerNum);
@@ -512,10 +546,13 @@ public:
   Sci::Position GetEndStyled() const noexcept { return endStyled; }
   void EnsureStyledTo(Sci::Position pos);
   void StyleToAdjustingLineDuration(Sci::Position pos);
+  /// Total bytes styled through EnsureStyledTo over the document's life
+  Sci::Position BytesStyled() const noexcept { return bytesStyled; }
   int GetStyleClock() const noexcept { return styleClock; }
   void IncrementStyleClock() noexcept;
   void SCI_METHOD DecorationSetCurrentIndicator(int indicator) override;
   void SCI_METHOD DecorationFillRange(Sci_Position position, int value, Sci_Position fillLength) override;
+  void DecorationFillRanges(const Scintilla::IndicatorFill *fills, size_t count);
   LexInterface *GetLexInterface() const noexcept;
   void SetLexInterface(std::unique_ptr<LexInterface> pLexInterface) noexcept;
 
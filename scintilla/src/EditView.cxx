@@ -192,6 +192,7 @@ EditView::EditView() {
 	llc.SetLevel(LineCache::Caret);
 	posCache = CreatePositionCache();
 	posCache->SetSize(0x400);
+	posCache->SetProfile(&profile);
 	maxLayoutThreads = 1;
 	tabArrowHeight = 4;
 	customDrawTabArrow = nullptr;
@@ -274,6 +275,7 @@ void EditView::DropGraphics() noexcept {
 	pixmapLine.reset();
 	pixmapIndentGuide.reset();
 	pixmapIndentGuideHighlight.reset();
+	rasterCache.Clear();
 }
 
 void EditView::RefreshPixMaps(Surface *surfaceWindow, const ViewStyle &vsDraw) {
@@ -442,6 +444,7 @@ void EditView::LayoutLine(const EditModel &model, Surface *surface, const ViewSt
 		}
 	}
 	if (ll->validity == LineLayout::ValidLevel::invalid) {
+		ElapsedPeriod epLayout;
 		ll->widthLine = LineLayout::wrapWidthInfinite;
 		ll->lines = 1;
 		if (vstyle.edgeState == EdgeVisualStyle::Background) {
@@ -552,6 +555,8 @@ void EditView::LayoutLine(const EditModel &model, Surface *surface, const ViewSt
 		ll->numCharsInLine = numCharsInLine;
 		ll->numCharsBeforeEOL = numCharsBeforeEOL;
 		ll->validity = LineLayout::ValidLevel::positions;
+		profile.Add(ProfileCounter::LinesLaidOut, 1);
+		profile.AddDuration(ProfileCounter::LayoutTime, epLayout.Duration());
 	}
 	if ((ll->validity == LineLayout::ValidLevel::positions) || (ll->widthLine != width)) {
 		ll->widthLine = width;
@@ -599,6 +604,83 @@ void EditView::LayoutLine(const EditModel &model, Surface *surface, const ViewSt
 	}
 }
 
+// Lay out the document lines shown on the visible lines from visibleLineFirst up to visibleLineEnd
+// on multiple threads so that drawing, which must be sequential, finds them ready.
+// Returns the layouts to use for drawing, which is empty when layout can only use one thread.
+std::vector<std::shared_ptr<LineLayout>> EditView::LayoutVisibleLines(Surface *surface, const EditModel &model,
+	const ViewStyle &vstyle, Sci::Line visibleLineFirst, Sci::Line visibleLineEnd) {
+	std::vector<std::shared_ptr<LineLayout>> layouts;
+	if ((maxLayoutThreads <= 1) || !surface->SupportsFeature(Supports::ThreadSafeMeasureWidths)) {
+		return layouts;
+	}
+
+	// Cached layouts are only kept until drawing when the cache has an entry for each visible line.
+	// Otherwise lines share an entry so lay out into separate objects for this paint.
+	const bool cachePerLine = (llc.GetLevel() == LineCache::Page) || (llc.GetLevel() == LineCache::Document);
+	std::vector<Sci::Line> lines;
+	visibleLineEnd = std::min(visibleLineEnd, model.pcs->LinesDisplayed());
+	for (Sci::Line visibleLine = visibleLineFirst; visibleLine < visibleLineEnd; visibleLine++) {
+		const Sci::Line lineDoc = model.pcs->DocFromDisplay(visibleLine);
+		if (!lines.empty() && (lines.back() == lineDoc)) {
+			continue;	// Wrapped onto more than one visible line
+		}
+		const int subLine = static_cast<int>(visibleLine - model.pcs->DisplayFromDoc(lineDoc));
+		if (rasterCache.Find(lineDoc, subLine)) {
+			continue;	// Will be copied from its raster so does not need to be laid out
+		}
+		std::shared_ptr<LineLayout> ll;
+		if (cachePerLine) {
+			ll = RetrieveLineLayout(lineDoc, model);
+			// Page cache entries are chosen by line number so, with folding, an earlier line may
+			// have been in the entry just reused for this line. Give the earlier line its own layout.
+			for (size_t i = 0; i < layouts.size(); i++) {
+				if (layouts[i] == ll) {
+					layouts[i] = std::make_shared<LineLayout>(lines[i],
+						static_cast<int>(model.pdoc->LineRange(lines[i]).Length()));
+				}
+			}
+		} else {
+			ll = std::make_shared<LineLayout>(lineDoc, static_cast<int>(model.pdoc->LineRange(lineDoc).Length()));
+		}
+		lines.push_back(lineDoc);
+		layouts.push_back(ll);
+	}
+
+	// Long lines are left for drawing where LayoutLine spreads each over multiple threads
+	std::vector<LineLayout *> linesToLayout;
+	for (size_t i = 0; i < layouts.size(); i++) {
+		LineLayout *ll = layouts[i].get();
+		const bool valid = (ll->validity == LineLayout::ValidLevel::lines) && (ll->widthLine == model.wrapWidth);
+		if (!valid && (model.pdoc->LineRange(lines[i]).Length() < lengthToMultiThread)) {
+			linesToLayout.push_back(ll);
+		}
+	}
+	const size_t threads = std::min<size_t>(linesToLayout.size(), maxLayoutThreads);
+	if (threads <= 1) {
+		return layouts;
+	}
+
+	std::atomic<size_t> nextIndex = 0;
+	std::vector<std::future<void>> futures;
+	for (size_t th = 0; th < threads; th++) {
+		std::future<void> fut = std::async(std::launch::async,
+			[this, surface, &model, &vstyle, &linesToLayout, &nextIndex]() {
+			while (true) {
+				const size_t i = nextIndex.fetch_add(1, std::memory_order_acq_rel);
+				if (i >= linesToLayout.size()) {
+					break;
+				}
+				LayoutLine(model, surface, vstyle, linesToLayout[i], model.wrapWidth, true);
+			}
+		});
+		futures.push_back(std::move(fut));
+	}
+	for (const std::future<void> &f : futures) {
+		f.wait();
+	}
+	return layouts;
+}
+
 // Fill the LineLayout bidirectional data fields according to each char style
 
 void EditView::UpdateBidiData(const EditModel &model, const ViewStyle &vstyle, LineLayout *ll) {
@@ -1977,8 +2059,11 @@ void DrawIndicators(Surface *surface, const EditModel &model, const ViewStyle &v
 	const Sci::Position lineStart = ll->LineStart(subLine);
 	const Sci::Position posLineEnd = posLineStart + lineEnd;
 
+	// One query for the line so decorations with nothing here are not searched run by run
+	const uint64_t indicatorsOnLine = model.pdoc->decorations->AllOnInRange(posLineStart + lineStart, posLineEnd);
 	for (const IDecoration *deco : model.pdoc->decorations->View()) {
-		if (under == vsDraw.indicators[deco->Indicator()].under) {
+		if (IndicatorInMask(indicatorsOnLine, deco->Indicator()) &&
+			(under == vsDraw.indicators[deco->Indicator()].under)) {
 			Sci::Position startPos = posLineStart + lineStart;
 			while (startPos < posLineEnd) {
 				const Range rangeRun(deco->StartRun(startPos), deco->EndRun(startPos));
@@ -2138,6 +2223,8 @@ void EditView::DrawForeground(Surface *surface, const EditModel &model, const Vi
 	const BreakFinder::BreakFor breakFor = (((phasesDraw == PhasesDraw::One) && selBackDrawn) || vsDraw.SelectionTextDrawn())
 		? BreakFinder::BreakFor::ForegroundAndSelection : BreakFinder::BreakFor::Foreground;
 	BreakFinder bfFore(ll, &model.sel, lineRange, posLineStart, xStartVisible, breakFor, model.pdoc, model.reprs.get(), &vsDraw);
+	const uint64_t indicatorsOnLine = vsDraw.indicatorsSetFore ?
+		model.pdoc->decorations->AllOnInRange(posLineStart + lineRange.start, posLineStart + lineRange.end) : 0;
 
 	while (bfFore.More()) {
 
@@ -2160,9 +2247,12 @@ void EditView::DrawForeground(Surface *surface, const EditModel &model, const Vi
 					textFore = *colourHotSpot;
 				}
 			}
-			if (vsDraw.indicatorsSetFore) {
-				// At least one indicator sets the text colour so see if it applies to this segment
+			if (indicatorsOnLine) {
+				// At least one indicator sets the text colour and is on this line so see if it applies to this segment
 				for (const IDecoration *deco : model.pdoc->decorations->View()) {
+					if (!IndicatorInMask(indicatorsOnLine, deco->Indicator())) {
+						continue;
+					}
 					const int indicatorValue = deco->ValueAt(ts.start + posLineStart);
 					if (indicatorValue) {
 						const Indicator &indicator = vsDraw.indicators[deco->Indicator()];
@@ -2476,6 +2566,22 @@ void EditView::DrawLine(Surface *surface, const EditModel &model, const ViewStyl
 	}
 }
 
+namespace {
+
+// Rasters are kept for the screen being painted and the screens either side of it
+constexpr size_t rasterScreensCached = 3;
+
+std::shared_ptr<LineLayout> FindLayout(const std::vector<std::shared_ptr<LineLayout>> &layouts, Sci::Line line) {
+	for (const std::shared_ptr<LineLayout> &ll : layouts) {
+		if (ll->LineNumber() == line) {
+			return ll;
+		}
+	}
+	return {};
+}
+
+}
+
 void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const ViewStyle &vsDraw,
 	PRectangle rcArea, PRectangle rcClient) {
 	// Allow text at start of line to overlap 1 pixel into the margin as this displays
@@ -2497,6 +2603,13 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 		const int screenLinePaintFirst = static_cast<int>(rcArea.top) / vsDraw.lineHeight;
 		const int xStart = vsDraw.textStart - model.xOffset + static_cast<int>(ptOrigin.x);
 
+		// When caching rasters, each line is drawn into its own pixmap which is kept for later paints
+		const bool rasterCaching = rasterCache.Enabled() && vsDraw.marginInside;
+		const bool lineBuffered = bufferedDraw || rasterCaching;
+		if (rasterCaching) {
+			rasterCache.SetGeometry(xStart, static_cast<int>(rcClient.Width()), vsDraw.lineHeight);
+		}
+
 		const SelectionPosition posCaret = model.posDrag.IsValid() ? model.posDrag : model.sel.RangeMain().caret;
 		const Sci::Line lineCaret = model.pdoc->SciLineFromPosition(posCaret.Position());
 		const int caretOffset = static_cast<int>(posCaret.Position() - model.pdoc->LineStart(lineCaret));
@@ -2511,7 +2624,7 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 
 		// Remove selection margin from drawing area so text will not be drawn
 		// on it in unbuffered mode.
-		const bool clipping = !bufferedDraw && vsDraw.marginInside;
+		const bool clipping = !lineBuffered && vsDraw.marginInside;
 		if (clipping) {
 			PRectangle rcClipText = rcTextArea;
 			rcClipText.left -= leftTextOverlap;
@@ -2528,10 +2641,17 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 		const bool bracesIgnoreStyle = ((vsDraw.braceHighlightIndicatorSet && (model.bracesMatchStyle == StyleBraceLight)) ||
 			(vsDraw.braceBadLightIndicatorSet && (model.bracesMatchStyle == StyleBraceBad)));
 
+		// Lay out the lines to be drawn concurrently when possible
+		const Sci::Line visibleLinePaintFirst = model.TopLineOfMain() + screenLinePaintFirst;
+		const Sci::Line visibleLinePaintEnd = model.TopLineOfMain() +
+			static_cast<Sci::Line>(std::ceil(rcArea.bottom / vsDraw.lineHeight));
+		const std::vector<std::shared_ptr<LineLayout>> layoutsVisible =
+			LayoutVisibleLines(surface, model, vsDraw, visibleLinePaintFirst, visibleLinePaintEnd);
+
 		Sci::Line lineDocPrevious = -1;	// Used to avoid laying out one document line multiple times
 		std::shared_ptr<LineLayout> ll;
 		std::vector<DrawPhase> phases;
-		if ((phasesDraw == PhasesDraw::Multiple) && !bufferedDraw) {
+		if ((phasesDraw == PhasesDraw::Multiple) && !lineBuffered) {
 			for (DrawPhase phase = DrawPhase::back; phase <= DrawPhase::carets; phase = static_cast<DrawPhase>(static_cast<int>(phase) * 2)) {
 				phases.push_back(phase);
 			}
@@ -2540,7 +2660,7 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 		}
 		for (const DrawPhase &phase : phases) {
 			int ypos = 0;
-			if (!bufferedDraw)
+			if (!lineBuffered)
 				ypos += screenLinePaintFirst * vsDraw.lineHeight;
 			int yposScreen = screenLinePaintFirst * vsDraw.lineHeight;
 			Sci::Line visibleLine = model.TopLineOfMain() + screenLinePaintFirst;
@@ -2552,20 +2672,41 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 				const Sci::Line lineStartSet = model.pcs->DisplayFromDoc(lineDoc);
 				const int subLine = static_cast<int>(visibleLine - lineStartSet);
 
+				const Point from = Point::FromInts(vsDraw.textStart - leftTextOverlap, 0);
+				const PRectangle rcCopyArea = PRectangle::FromInts(vsDraw.textStart - leftTextOverlap, yposScreen,
+					static_cast<int>(rcClient.right - vsDraw.rightMarginWidth),
+					yposScreen + vsDraw.lineHeight);
+				LineRaster *raster = rasterCaching ? rasterCache.Find(lineDoc, subLine) : nullptr;
+
 				// Copy this line and its styles from the document into local arrays
 				// and determine the x position at which each character starts.
 #if defined(TIME_PAINTING)
 				ElapsedPeriod ep;
 #endif
-				if (lineDoc != lineDocPrevious) {
-					ll = RetrieveLineLayout(lineDoc, model);
+				if (!raster && (lineDoc != lineDocPrevious)) {
+					ll = FindLayout(layoutsVisible, lineDoc);
+					if (!ll) {
+						ll = RetrieveLineLayout(lineDoc, model);
+					}
 					LayoutLine(model, surface, vsDraw, ll.get(), model.wrapWidth);
 					lineDocPrevious = lineDoc;
 				}
 #if defined(TIME_PAINTING)
 				durLayout += ep.Duration(true);
 #endif
-				if (ll) {
+				if (raster) {
+					// Nothing affecting this line has changed since it was drawn
+					surfaceWindow->Copy(rcCopyArea, from, *raster->surface);
+					lineWidthMaxSeen = std::max(lineWidthMaxSeen, static_cast<int>(raster->widthLine));
+				} else if (ll) {
+					Surface *surfaceLine = surface;
+					if (rasterCaching) {
+						raster = rasterCache.Add(lineDoc, subLine,
+							surfaceWindow->AllocatePixMap(static_cast<int>(rcClient.Width()), vsDraw.lineHeight));
+						surfaceLine = raster->surface.get();
+						surfaceLine->SetMode(model.CurrentSurfaceMode());
+					}
+
 					ll->containsCaret = vsDraw.selection.visible && (lineDoc == lineCaret)
 						&& (ll->lines == 1 || !vsDraw.caretLine.subLine || ll->InLine(caretOffset, subLine));
 
@@ -2580,12 +2721,12 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 					ll->SetBracesHighlight(rangeLine, model.braces, static_cast<char>(model.bracesMatchStyle),
 						static_cast<int>(model.highlightGuideColumn * vsDraw.spaceWidth), bracesIgnoreStyle);
 
-					if (leftTextOverlap && (bufferedDraw || ((phasesDraw < PhasesDraw::Multiple) && (FlagSet(phase, DrawPhase::back))))) {
+					if (leftTextOverlap && (lineBuffered || ((phasesDraw < PhasesDraw::Multiple) && (FlagSet(phase, DrawPhase::back))))) {
 						// Clear the left margin
 						PRectangle rcSpacer = rcLine;
 						rcSpacer.right = rcSpacer.left;
 						rcSpacer.left -= 1;
-						surface->FillRectangleAligned(rcSpacer, Fill(vsDraw.styles[StyleDefault].back));
+						surfaceLine->FillRectangleAligned(rcSpacer, Fill(vsDraw.styles[StyleDefault].back));
 					}
 
 					if (model.BidirectionalEnabled()) {
@@ -2593,7 +2734,7 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 						UpdateBidiData(model, vsDraw, ll.get());
 					}
 
-					DrawLine(surface, model, vsDraw, ll.get(), lineDoc, visibleLine, xStart, rcLine, subLine, phase);
+					DrawLine(surfaceLine, model, vsDraw, ll.get(), lineDoc, visibleLine, xStart, rcLine, subLine, phase);
 #if defined(TIME_PAINTING)
 					durPaint += ep.Duration(true);
 #endif
@@ -2601,30 +2742,29 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 					ll->RestoreBracesHighlight(rangeLine, model.braces, bracesIgnoreStyle);
 
 					if (FlagSet(phase, DrawPhase::foldLines)) {
-						DrawFoldLines(surface, model, vsDraw, ll.get(), lineDoc, rcLine, subLine);
+						DrawFoldLines(surfaceLine, model, vsDraw, ll.get(), lineDoc, rcLine, subLine);
 					}
 
 					if (FlagSet(phase, DrawPhase::carets)) {
-						DrawCarets(surface, model, vsDraw, ll.get(), lineDoc, xStart, rcLine, subLine);
+						DrawCarets(surfaceLine, model, vsDraw, ll.get(), lineDoc, xStart, rcLine, subLine);
 					}
 
-					if (bufferedDraw) {
-						const Point from = Point::FromInts(vsDraw.textStart - leftTextOverlap, 0);
-						const PRectangle rcCopyArea = PRectangle::FromInts(vsDraw.textStart - leftTextOverlap, yposScreen,
-							static_cast<int>(rcClient.right - vsDraw.rightMarginWidth),
-							yposScreen + vsDraw.lineHeight);
-						pixmapLine->FlushDrawing();
-						surfaceWindow->Copy(rcCopyArea, from, *pixmapLine);
+					if (lineBuffered) {
+						surfaceLine->FlushDrawing();
+						surfaceWindow->Copy(rcCopyArea, from, *surfaceLine);
 					}
 
 					lineWidthMaxSeen = std::max(
 						lineWidthMaxSeen, static_cast<int>(ll->positions[ll->numCharsInLine]));
+					if (raster) {
+						raster->widthLine = ll->positions[ll->numCharsInLine];
+					}
 #if defined(TIME_PAINTING)
 					durCopy += ep.Duration(true);
 #endif
 				}
 
-				if (!bufferedDraw) {
+				if (!lineBuffered) {
 					ypos += vsDraw.lineHeight;
 				}
 
@@ -2633,6 +2773,10 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 			}
 		}
 		ll.reset();
+		if (rasterCaching) {
+			const size_t linesOnScreen = static_cast<size_t>(rcClient.Height()) / vsDraw.lineHeight + 1;
+			rasterCache.Trim(linesOnScreen * rasterScreensCached);
+		}
 #if defined(TIME_PAINTING)
 		if (durPaint < 0.00000001)
 			durPaint = 0.00000001;
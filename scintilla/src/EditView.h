@@ -12,6 +12,7 @@
 #include "MarginView.h"
 #include "Platform.h"
 #include "PositionCache.h"
+#include "ProfileCounters.h"
 #include "ScintillaStructures.h"
 
 namespace Scintilla::Internal {
@@ -84,10 +85,16 @@ public:
   std::unique_ptr<Surface> pixmapIndentGuideHighlight;
 
   LineLayoutCache llc;
+  LineRasterCache rasterCache;
   std::unique_ptr<IPositionCache> posCache;
+  ProfileCounters profile;
 
   unsigned int maxLayoutThreads;
   static constexpr int bytesPerLayoutThread = 1000;
+  // Lines less than lengthToMultiThread are laid out in blocks in parallel.
+  // Longer lines are multi-threaded inside LayoutLine.
+  // This allows faster processing when lines differ greatly in length and thus time to lay out.
+  static constexpr Sci::Position lengthToMultiThread = 4000;
 
   int tabArrowHeight; // draw arrow heads this many pixels above/below line midpoint
   /** Some platforms, notably PLAT_CURSES, do not support Scintilla's native
@@ -125,6 +132,9 @@ public:
   std::shared_ptr<LineLayout> RetrieveLineLayout(Sci::Line lineNumber, const EditModel &model);
   void LayoutLine(const EditModel &model, Surface *surface, const ViewStyle &vstyle, LineLayout *ll, int width,
                   bool callerMultiThreaded = false);
+  std::vector<std::shared_ptr<LineLayout>> LayoutVisibleLines(Surface *surface, const EditModel &model,
+                                                              const ViewStyle &vstyle, Sci::Line visibleLineFirst,
+                                                              Sci::Line visibleLineEnd);
 
   static void UpdateBidiData(const EditModel &model, const ViewStyle &vstyle, LineLayout *ll);
 
@@ -202,6 +202,8 @@ Editor::Editor() : durationWrapOneByte(0.000001, 0.00000001, 0.00001) {
 	recordingMacro = false;
 	foldAutomatic = AutomaticFold::None;
 
+	bytesStyledStart = 0;
+
 	convertPastes = true;
 
 	SetRepresentations();
@@ -441,15 +443,33 @@ void Editor::RedrawRect(PRectangle rc) {
 		rc.right = rcClient.right;
 
 	if ((rc.bottom > rc.top) && (rc.right > rc.left)) {
+		InvalidateRasters(rc);
 		wMain.InvalidateRectangle(rc);
 	}
 }
 
+void Editor::InvalidateRasters(PRectangle rc) {
+	// Discard the kept images of the lines in the area as their appearance is changing
+	if (view.rasterCache.Count() == 0) {
+		return;
+	}
+	const Sci::Line visibleLineFirst = TopLineOfMain() + static_cast<Sci::Line>(rc.top) / vs.lineHeight;
+	const Sci::Line visibleLineLast = TopLineOfMain() + static_cast<Sci::Line>(rc.bottom - 1) / vs.lineHeight;
+	view.rasterCache.InvalidateLines(pcs->DocFromDisplay(visibleLineFirst), pcs->DocFromDisplay(visibleLineLast));
+}
+
 void Editor::DiscardOverdraw() {
 	// Overridden on platforms that may draw outside visible area.
 }
 
 void Editor::Redraw() {
+	view.rasterCache.Clear();
+	RedrawScrolled();
+}
+
+// Redraw everything after scrolling vertically which moves lines without changing their appearance
+// so kept line images remain valid.
+void Editor::RedrawScrolled() {
 	if (redrawPendingText) {
 		return;
 	}
@@ -937,7 +957,7 @@ void Editor::ScrollTo(Sci::Line line, bool moveThumb) {
 		if (performBlit) {
 			ScrollText(linesToMove);
 		} else {
-			Redraw();
+			RedrawScrolled();
 		}
 		willRedrawAll = false;
 #else
@@ -951,7 +971,7 @@ void Editor::ScrollTo(Sci::Line line, bool moveThumb) {
 
 void Editor::ScrollText(Sci::Line /* linesToMove */) {
 	//Platform::DebugPrintf("Editor::ScrollText %d\n", linesToMove);
-	Redraw();
+	RedrawScrolled();
 }
 
 void Editor::HorizontalScrollTo(int xPos) {
@@ -1477,15 +1497,6 @@ bool Editor::WrapOneLine(Surface *surface, Sci::Line lineToWrap) {
 	return pcs->SetHeight(lineToWrap, linesWrapped);
 }
 
-namespace {
-
-// Lines less than lengthToMultiThread are laid out in blocks in parallel.
-// Longer lines are multi-threaded inside LayoutLine.
-// This allows faster processing when lines differ greatly in length and thus time to lay out.
-constexpr Sci::Position lengthToMultiThread = 4000;
-
-}
-
 bool Editor::WrapBlock(Surface *surface, Sci::Line lineToWrap, Sci::Line lineToWrapEnd) {
 
 	const size_t linesBeingWrapped = static_cast<size_t>(lineToWrapEnd - lineToWrap);
@@ -1533,7 +1544,7 @@ bool Editor::WrapBlock(Surface *surface, Sci::Line lineToWrap, Sci::Line lineToW
 				const Sci::Line lineNumber = lineToWrap + i;
 				const Range rangeLine = pdoc->LineRange(lineNumber);
 				const Sci::Position lengthLine = rangeLine.Length();
-				if (lengthLine < lengthToMultiThread) {
+				if (lengthLine < EditView::lengthToMultiThread) {
 					std::shared_ptr<LineLayout> ll;
 					if (significantLines.LineMayCache(lineNumber)) {
 						std::lock_guard<std::mutex> guard(mutexRetrieve);
@@ -1566,7 +1577,7 @@ bool Editor::WrapBlock(Surface *surface, Sci::Line lineToWrap, Sci::Line lineToW
 		const Sci::Line lineNumber = lineToWrap + indexLarge;
 		const Range rangeLine = pdoc->LineRange(lineNumber);
 		const Sci::Position lengthLine = rangeLine.Length();
-		if (lengthLine >= lengthToMultiThread) {
+		if (lengthLine >= EditView::lengthToMultiThread) {
 			std::shared_ptr<LineLayout> ll;
 			if (significantLines.LineMayCache(lineNumber)) {
 				ll = view.RetrieveLineLayout(lineNumber, *this);
@@ -1597,6 +1608,7 @@ bool Editor::WrapBlock(Surface *surface, Sci::Line lineToWrap, Sci::Line lineToW
 	}
 
 	durationWrapOneByte.AddSample(bytesBeingWrapped, durationShortLinesThreads + durationLongLines);
+	view.profile.AddDuration(ProfileCounter::WrapTime, durationShortLines + durationLongLines);
 
 	return wrapsDone > 0;
 }
@@ -1812,6 +1824,8 @@ void Editor::RefreshPixMaps(Surface *surfaceWindow) {
 }
 
 void Editor::Paint(Surface *surfaceWindow, PRectangle rcArea) {
+	view.profile.Add(ProfileCounter::Paints, 1);
+	const ProfileDuration pdPaint(view.profile, ProfileCounter::PaintTime);
 	redrawPendingText = false;
 	redrawPendingMargin = false;
 
@@ -2041,6 +2055,21 @@ void Editor::InsertCharacter(std::string_view sv, CharacterSource charSource) {
 		std::sort(selPtrs.begin(), selPtrs.end(),
 			[](const SelectionRange *a, const SelectionRange *b) noexcept {return *a < *b;});
 
+		// Common case of many simple selections is performed as one document modification.
+		if (!inOverstrike && ReplaceSelectionsBatched(selPtrs, sv)) {
+			selPtrs.clear();
+			if (Wrapping()) {
+				AutoSurface surface(this);
+				if (surface) {
+					for (size_t r = 0; r < sel.Count(); r++) {
+						if (WrapOneLine(surface, pdoc->SciLineFromPosition(sel.Range(r).caret.Position()))) {
+							wrapOccurred = true;
+						}
+					}
+				}
+			}
+		}
+
 		// Loop in reverse to avoid disturbing positions of selections yet to be processed.
 		for (std::vector<SelectionRange *>::reverse_iterator rit = selPtrs.rbegin();
 			rit != selPtrs.rend(); ++rit) {
@@ -2124,6 +2153,41 @@ void Editor::InsertCharacter(std::string_view sv, CharacterSource charSource) {
 	}
 }
 
+// Replace each of a set of ordered selections with text as a single document modification.
+// Only performed when there are multiple selections that are disjoint, contain no virtual
+// space and are not protected, otherwise returns false so the caller edits one at a time.
+bool Editor::ReplaceSelectionsBatched(const std::vector<SelectionRange *> &selPtrs, std::string_view sv) {
+	if (selPtrs.size() < 2) {
+		return false;
+	}
+	std::vector<Replacement> replacements;
+	replacements.reserve(selPtrs.size());
+	Sci::Position previousEnd = 0;
+	bool changes = !sv.empty();
+	for (const SelectionRange *range : selPtrs) {
+		const Sci::Position start = range->Start().Position();
+		const Sci::Position end = range->End().Position();
+		if ((start < previousEnd) || range->caret.VirtualSpace() || range->anchor.VirtualSpace() ||
+			RangeContainsProtected(start, end)) {
+			return false;
+		}
+		replacements.emplace_back(start, end - start, sv);
+		changes = changes || (end > start);
+		previousEnd = end;
+	}
+	if (!changes || !pdoc->ReplaceRanges(replacements)) {
+		return false;
+	}
+	// Insertions at a caret do not move it so place each caret after its insertion.
+	Sci::Position delta = 0;
+	for (size_t r = 0; r < selPtrs.size(); r++) {
+		delta += replacements[r].lengthInserted;
+		*selPtrs[r] = SelectionRange(replacements[r].position + delta);
+		delta -= replacements[r].lengthDelete;
+	}
+	return true;
+}
+
 void Editor::ClearBeforeTentativeStart() {
 	// Make positions for the first composition string.
 	FilterSelections();
@@ -2214,13 +2278,21 @@ void Editor::ClearSelection(bool retainMultipleSelections) {
 	if (!sel.IsRectangular() && !retainMultipleSelections)
 		FilterSelections();
 	UndoGroup ug(pdoc);
-	for (size_t r=0; r<sel.Count(); r++) {
-		if (!sel.Range(r).Empty()) {
-			if (!RangeContainsProtected(sel.Range(r).Start().Position(),
-				sel.Range(r).End().Position())) {
-				pdoc->DeleteChars(sel.Range(r).Start().Position(),
-					sel.Range(r).Length());
-				sel.Range(r) = SelectionRange(sel.Range(r).Start());
+	std::vector<SelectionRange *> selPtrs;
+	for (size_t r = 0; r < sel.Count(); r++) {
+		selPtrs.push_back(&sel.Range(r));
+	}
+	std::sort(selPtrs.begin(), selPtrs.end(),
+		[](const SelectionRange *a, const SelectionRange *b) noexcept {return *a < *b;});
+	if (!ReplaceSelectionsBatched(selPtrs, {})) {
+		for (size_t r=0; r<sel.Count(); r++) {
+			if (!sel.Range(r).Empty()) {
+				if (!RangeContainsProtected(sel.Range(r).Start().Position(),
+					sel.Range(r).End().Position())) {
+					pdoc->DeleteChars(sel.Range(r).Start().Position(),
+						sel.Range(r).Length());
+					sel.Range(r) = SelectionRange(sel.Range(r).Start());
+				}
 			}
 		}
 	}
@@ -2685,6 +2757,13 @@ constexpr Sci::Position MovePositionForDeletion(Sci::Position position, Sci::Pos
 
 void Editor::NotifyModified(Document *, DocModification mh, void *) {
 	ContainerNeedsUpdate(Update::Content);
+	if (view.rasterCache.Count() > 0) {
+		// Changes made while painting do not cause redraws and changes may move later lines
+		// so discard the images of all lines after the change. The line before the change
+		// depends on the fold level of the changed line for fold lines.
+		const Sci::Line lineChanged = pdoc->SciLineFromPosition(mh.position);
+		view.rasterCache.InvalidateLines(std::max<Sci::Line>(lineChanged - 1, 0), pdoc->LinesTotal());
+	}
 	if (paintState == PaintState::painting) {
 		CheckForChangeOutsidePaint(Range(mh.position, mh.position + mh.length));
 	}
@@ -5153,6 +5232,7 @@ void Editor::ButtonUpWithModifiers(Point pt, unsigned int curTime, KeyMod modifi
 }
 
 bool Editor::Idle() {
+	const ProfileDuration pdIdle(view.profile, ProfileCounter::IdleTime);
 	NotifyUpdateUI();
 
 	bool needWrap = Wrapping() && wrapPending.NeedsWrap();
@@ -5342,6 +5422,7 @@ void Editor::IdleStyle() {
 }
 
 void Editor::IdleWork() {
+	const ProfileDuration pdIdleWork(view.profile, ProfileCounter::IdleTime);
 	// Style the line after the modification as this allows modifications that change just the
 	// line of the modification to heal instead of propagating to the rest of the window.
 	if (FlagSet(workNeeded.items, WorkItems::style)) {
@@ -5447,6 +5528,8 @@ void Editor::SetAnnotationHeights(Sci::Line start, Sci::Line end) {
 
 void Editor::SetDocPointer(Document *document) {
 	//Platform::DebugPrintf("** %x setdoc to %x\n", pdoc, document);
+	// Keep the bytes styled in the old document as the counter is for this view
+	view.profile.Add(ProfileCounter::StyledBytes, pdoc->BytesStyled() - bytesStyledStart);
 	pdoc->RemoveWatcher(this, nullptr);
 	pdoc->Release();
 	if (!document) {
@@ -5455,6 +5538,7 @@ void Editor::SetDocPointer(Document *document) {
 		pdoc = document;
 	}
 	pdoc->AddRef();
+	bytesStyledStart = pdoc->BytesStyled();
 	pcs = ContractionStateCreate(pdoc->IsLarge());
 
 	// Ensure all positions within document
@@ -6678,6 +6762,16 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		pdoc->ChangeLastUndoActionText(wParam, CharPtrFromSPtr(lParam));
 		break;
 
+	case Message::SetUndoMemoryLimit:
+		pdoc->SetUndoMemoryLimit(wParam);
+		break;
+
+	case Message::GetUndoMemoryLimit:
+		return pdoc->UndoMemoryLimit();
+
+	case Message::GetUndoMemory:
+		return pdoc->UndoMemory();
+
 	case Message::GetCaretPeriod:
 		return caret.period;
 
@@ -6962,6 +7056,14 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::GetBufferedDraw:
 		return view.bufferedDraw;
 
+	case Message::SetLineRasterCache:
+		view.rasterCache.SetEnabled(wParam != 0);
+		Redraw();
+		break;
+
+	case Message::GetLineRasterCache:
+		return view.rasterCache.Enabled();
+
 #ifdef INCLUDE_DEPRECATED_FEATURES
 	case SCI_GETTWOPHASEDRAW:
 		return view.phasesDraw == EditView::phasesTwo;
@@ -7168,6 +7270,19 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::GetLayoutThreads:
 		return view.GetLayoutThreads();
 
+	case Message::GetProfileCounter: {
+			const ProfileCounter counter = static_cast<ProfileCounter>(wParam);
+			if (counter == ProfileCounter::StyledBytes) {
+				return view.profile.Get(counter) + pdoc->BytesStyled() - bytesStyledStart;
+			}
+			return view.profile.Get(counter);
+		}
+
+	case Message::ResetProfileCounters:
+		view.profile.Reset();
+		bytesStyledStart = pdoc->BytesStyled();
+		break;
+
 	case Message::SetScrollWidth:
 		PLATFORM_ASSERT(wParam > 0);
 		if ((wParam > 0) && (wParam != static_cast<unsigned int>(scrollWidth))) {
@@ -7433,6 +7548,10 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		return pdoc->MarkerNext(LineFromUPtr(wParam), static_cast<int>(lParam));
 
 	case Message::MarkerPrevious: {
+			if (!FlagSet(changeHistoryOption, ChangeHistoryOption::Markers)) {
+				// Only document markers can match so use their summaries
+				return pdoc->MarkerPrevious(LineFromUPtr(wParam), static_cast<int>(lParam));
+			}
 			for (Sci::Line iLine = LineFromUPtr(wParam); iLine >= 0; iLine--) {
 				if ((GetMark(iLine) & lParam) != 0)
 					return iLine;
@@ -8104,6 +8223,15 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 			lParam);
 		break;
 
+	case Message::IndicatorFillRanges: {
+			const Sci::Position count = PositionFromUPtr(wParam);
+			const IndicatorFill *fills = static_cast<const IndicatorFill *>(PtrFromSPtr(lParam));
+			if ((count > 0) && fills) {
+				pdoc->DecorationFillRanges(fills, count);
+			}
+		}
+		break;
+
 	case Message::IndicatorAllOnFor:
 		return pdoc->decorations->AllOnFor(PositionFromUPtr(wParam));
 
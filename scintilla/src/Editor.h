@@ -281,6 +281,9 @@ protected: // ScintillaBase subclass needs access to much of Editor
   WrapPending wrapPending;
   ActionDuration durationWrapOneByte;
 
+  // Bytes the document had styled when the profile counters started for it
+  Sci::Position bytesStyledStart;
+
   bool convertPastes;
 
   Editor();
@@ -329,6 +332,8 @@ protected: // ScintillaBase subclass needs access to much of Editor
   virtual void RedrawRect(PRectangle rc);
   virtual void DiscardOverdraw();
   virtual void Redraw();
+  void RedrawScrolled();
+  void InvalidateRasters(PRectangle rc);
   void RedrawSelMargin(Sci::Line line = -1, bool allAfter = false);
   PRectangle RectangleFromRange(Range r, int overlap);
   void InvalidateRange(Sci::Position start, Sci::Position end);
@@ -425,6 +430,7 @@ protected: // ScintillaBase subclass needs access to much of Editor
   SelectionPosition RealizeVirtualSpace(const SelectionPosition &position);
   void AddChar(char ch);
   virtual void InsertCharacter(std::string_view sv, Scintilla::CharacterSource charSource);
+  bool ReplaceSelectionsBatched(const std::vector<SelectionRange *> &selPtrs, std::string_view sv);
   void ClearBeforeTentativeStart();
   void InsertPaste(const char *text, Sci::Position len);
   enum class PasteShape { stream = 0, rectangular = 1, line = 2 };
@@ -8,11 +8,13 @@
 #include <cstddef>
 #include <cassert>
 #include <cstring>
+#include <cstdint>
 
 #include <stdexcept>
 #include <string_view>
 #include <vector>
-#include <forward_list>
+#include <array>
+#include <unordered_map>
 #include <optional>
 #include <algorithm>
 #include <memory>
@@ -56,52 +58,223 @@ bool MarkerHandleSet::Contains(int handle) const noexcept {
 }
 
 MarkerHandleNumber const *MarkerHandleSet::GetMarkerHandleNumber(int which) const noexcept {
-	for (const MarkerHandleNumber &mhn : mhList) {
-		if (which == 0)
-			return &mhn;
-		which--;
-	}
-	return nullptr;
+	// which counts from the most recently inserted
+	if ((which < 0) || (static_cast<size_t>(which) >= mhList.size()))
+		return nullptr;
+	return &mhList[mhList.size() - 1 - which];
 }
 
 bool MarkerHandleSet::InsertHandle(int handle, int markerNum) {
-	mhList.push_front(MarkerHandleNumber(handle, markerNum));
+	mhList.push_back(MarkerHandleNumber(handle, markerNum));
 	return true;
 }
 
 void MarkerHandleSet::RemoveHandle(int handle) {
-	mhList.remove_if([handle](const MarkerHandleNumber &mhn) noexcept { return mhn.handle == handle; });
+	mhList.erase(std::remove_if(mhList.begin(), mhList.end(),
+		[handle](const MarkerHandleNumber &mhn) noexcept { return mhn.handle == handle; }), mhList.end());
 }
 
 bool MarkerHandleSet::RemoveNumber(int markerNum, bool all) {
 	bool performedDeletion = false;
-	mhList.remove_if([&](const MarkerHandleNumber &mhn) noexcept {
-		if ((all || !performedDeletion) && (mhn.number == markerNum)) {
+	// Search from the back so that when !all the most recently added is removed.
+	for (size_t i = mhList.size(); i-- > 0;) {
+		if (mhList[i].number == markerNum) {
+			mhList.erase(mhList.begin() + i);
 			performedDeletion = true;
-			return true;
+			if (!all)
+				break;
 		}
-		return false;
-	});
+	}
 	return performedDeletion;
 }
 
 void MarkerHandleSet::CombineWith(MarkerHandleSet *other) noexcept {
-	mhList.splice_after(mhList.before_begin(), other->mhList);
+	// Other's markers are treated as more recent so go at the back
+	mhList.insert(mhList.end(), other->mhList.begin(), other->mhList.end());
+	other->mhList.clear();
+}
+
+namespace {
+
+// Labels are spread out when assigned in bulk so that many lines can be inserted between neighbours.
+// Starting in the middle of the range leaves room for inserting lines before the first.
+constexpr std::uint64_t labelBase = 1ULL << 62;
+constexpr std::uint64_t labelSpacing = 1ULL << 32;
+
+constexpr int MaskFromNumber(int markerNum) noexcept {
+	return (markerNum == -1) ? ~0 : (1 << markerNum);
+}
+
+}
+
+MarkerLines::MarkerLines(Sci::Line lines) {
+	starts.InsertText(0, lines);
+}
+
+Sci::Line MarkerLines::Count() const noexcept {
+	return labels.Length();
+}
+
+Sci::Line MarkerLines::LineFromIndex(Sci::Line index) const noexcept {
+	return starts.PositionFromPartition(index + 1);
+}
+
+Sci::Line MarkerLines::IndexFromLine(Sci::Line line) const noexcept {
+	const Sci::Line partition = starts.PartitionFromPosition(line);
+	if ((partition > 0) && (starts.PositionFromPartition(partition) == line)) {
+		// Line is present as the start of the partition after its index
+		return partition - 1;
+	}
+	return partition;
+}
+
+bool MarkerLines::Contains(Sci::Line line) const noexcept {
+	const Sci::Line index = IndexFromLine(line);
+	return (index < Count()) && (LineFromIndex(index) == line);
+}
+
+std::uint64_t MarkerLines::Label(Sci::Line index) const noexcept {
+	return labels.ValueAt(index);
+}
+
+Sci::Line MarkerLines::IndexFromLabel(std::uint64_t label) const noexcept {
+	Sci::Line lower = 0;
+	Sci::Line upper = Count();
+	while (lower < upper) {
+		const Sci::Line middle = lower + (upper - lower) / 2;
+		if (labels.ValueAt(middle) < label) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	if ((lower < Count()) && (labels.ValueAt(lower) == label)) {
+		return lower;
+	}
+	return -1;
+}
+
+void MarkerLines::Relabel() noexcept {
+	for (Sci::Line index = 0; index < Count(); index++) {
+		labels.SetValueAt(index, labelBase + static_cast<std::uint64_t>(index) * labelSpacing);
+	}
+}
+
+bool MarkerLines::Insert(Sci::Line index, Sci::Line line) {
+	// Choose a label between the neighbours' labels, 0 when there is no room.
+	std::uint64_t label = 0;
+	const Sci::Line count = Count();
+	if (count == 0) {
+		label = labelBase;
+	} else if (index == count) {
+		const std::uint64_t lower = labels.ValueAt(index - 1);
+		if (lower < (UINT64_MAX - labelSpacing)) {
+			label = lower + labelSpacing;
+		}
+	} else if (index == 0) {
+		const std::uint64_t upper = labels.ValueAt(0);
+		if (upper > labelSpacing) {
+			label = upper - labelSpacing;
+		}
+	} else {
+		const std::uint64_t lower = labels.ValueAt(index - 1);
+		const std::uint64_t upper = labels.ValueAt(index);
+		if ((upper - lower) > 1) {
+			label = lower + (upper - lower) / 2;
+		}
+	}
+	starts.InsertPartition(index + 1, line);
+	labels.Insert(index, label);
+	if (label == 0) {
+		Relabel();
+		return true;
+	}
+	return false;
+}
+
+void MarkerLines::Remove(Sci::Line index) {
+	starts.RemovePartition(index + 1);
+	labels.Delete(index);
+}
+
+void MarkerLines::SetLine(Sci::Line index, Sci::Line line) {
+	// SetPartitionStartPosition would move the step back over partitions without adjusting them
+	// so replace the partition instead.
+	starts.RemovePartition(index + 1);
+	starts.InsertPartition(index + 1, line);
+}
+
+// Move the lines at or after line by delta.
+void MarkerLines::Shift(Sci::Line line, Sci::Line delta) noexcept {
+	starts.InsertText(IndexFromLine(line), delta);
+}
+
+MarkerLines *LineMarkers::LinesOfNumber(int markerNum) const noexcept {
+	if ((markerNum < 0) || (markerNum > Scintilla::MarkerMax)) {
+		return nullptr;
+	}
+	return numberLines[markerNum].get();
+}
+
+// Set the labels of every handle of a marker number after its lines were relabelled.
+void LineMarkers::LocateHandles(int markerNum) {
+	const MarkerLines *lines = LinesOfNumber(markerNum);
+	for (Sci::Line index = 0; index < lines->Count(); index++) {
+		const MarkerHandleSet *onLine = markers[lines->LineFromIndex(index)].get();
+		for (const MarkerHandleNumber &mhn : *onLine) {
+			if (mhn.number == markerNum) {
+				handleLocations[mhn.handle].label = lines->Label(index);
+			}
+		}
+	}
+}
+
+// A marker number was removed from line so forget the line if no marker with that number remains.
+void LineMarkers::NumberRemoved(Sci::Line line, int markerNum) {
+	MarkerLines *lines = LinesOfNumber(markerNum);
+	if (lines && !(MarkValue(line) & MaskFromNumber(markerNum))) {
+		const Sci::Line index = lines->IndexFromLine(line);
+		if ((index < lines->Count()) && (lines->LineFromIndex(index) == line)) {
+			lines->Remove(index);
+		}
+	}
+}
+
+void LineMarkers::ForgetHandles(const MarkerHandleSet *onLine) noexcept {
+	if (onLine) {
+		for (const MarkerHandleNumber &mhn : *onLine) {
+			handleLocations.erase(mhn.handle);
+		}
+	}
+}
+
+void LineMarkers::ShiftLines(Sci::Line line, Sci::Line delta) noexcept {
+	for (const std::unique_ptr<MarkerLines> &lines : numberLines) {
+		if (lines) {
+			lines->Shift(line, delta);
+		}
+	}
 }
 
 void LineMarkers::Init() {
 	markers.DeleteAll();
+	handleLocations.clear();
+	for (std::unique_ptr<MarkerLines> &lines : numberLines) {
+		lines.reset();
+	}
 }
 
 void LineMarkers::InsertLine(Sci::Line line) {
 	if (markers.Length()) {
 		markers.Insert(line, nullptr);
+		ShiftLines(line, 1);
 	}
 }
 
 void LineMarkers::InsertLines(Sci::Line line, Sci::Line lines) {
 	if (markers.Length()) {
 		markers.InsertEmpty(line, lines);
+		ShiftLines(line, lines);
 	}
 }
 
@@ -110,18 +283,32 @@ void LineMarkers::RemoveLine(Sci::Line line) {
 	if (markers.Length()) {
 		if (line > 0) {
 			MergeMarkers(line - 1);
+		} else if (markers[line]) {
+			const int mask = markers[line]->MarkValue();
+			ForgetHandles(markers[line].get());
+			markers[line].reset();
+			for (int markerNum = 0; markerNum <= Scintilla::MarkerMax; markerNum++) {
+				if (mask & MaskFromNumber(markerNum)) {
+					NumberRemoved(line, markerNum);
+				}
+			}
 		}
 		markers.Delete(line);
+		ShiftLines(line, -1);
 	}
 }
 
 Sci::Line LineMarkers::LineFromHandle(int markerHandle) const noexcept {
-	for (Sci::Line line = 0; line < markers.Length(); line++) {
-		if (markers[line] && markers[line]->Contains(markerHandle)) {
-			return line;
-		}
+	const auto it = handleLocations.find(markerHandle);
+	if (it == handleLocations.end()) {
+		return -1;
 	}
-	return -1;
+	const MarkerLines *lines = LinesOfNumber(it->second.number);
+	const Sci::Line index = lines->IndexFromLabel(it->second.label);
+	if (index < 0) {
+		return -1;
+	}
+	return lines->LineFromIndex(index);
 }
 
 int LineMarkers::HandleFromLine(Sci::Line line, int which) const noexcept {
@@ -142,8 +329,26 @@ int LineMarkers::NumberFromLine(Sci::Line line, int which) const noexcept {
 
 void LineMarkers::MergeMarkers(Sci::Line line) {
 	if (markers[line + 1]) {
+		// Each marker number of the following line moves up to line unless already present there
+		const int maskLine = MarkValue(line);
+		const int maskNext = markers[line + 1]->MarkValue();
+		for (int markerNum = 0; markerNum <= Scintilla::MarkerMax; markerNum++) {
+			MarkerLines *lines = LinesOfNumber(markerNum);
+			if (lines && (maskNext & MaskFromNumber(markerNum))) {
+				const Sci::Line index = lines->IndexFromLine(line + 1);
+				if (maskLine & MaskFromNumber(markerNum)) {
+					lines->Remove(index);
+				} else {
+					lines->SetLine(index, line);
+				}
+			}
+		}
 		if (!markers[line])
 			markers[line] = std::make_unique<MarkerHandleSet>();
+		for (const MarkerHandleNumber &mhn : *markers[line + 1]) {
+			const MarkerLines *lines = LinesOfNumber(mhn.number);
+			handleLocations[mhn.handle].label = lines->Label(lines->IndexFromLine(line));
+		}
 		markers[line]->CombineWith(markers[line + 1].get());
 		markers[line + 1].reset();
 	}
@@ -159,13 +364,37 @@ int LineMarkers::MarkValue(Sci::Line line) const noexcept {
 Sci::Line LineMarkers::MarkerNext(Sci::Line lineStart, int mask) const noexcept {
 	if (lineStart < 0)
 		lineStart = 0;
-	const Sci::Line length = markers.Length();
-	for (Sci::Line iLine = lineStart; iLine < length; iLine++) {
-		const MarkerHandleSet *onLine = markers[iLine].get();
-		if (onLine && ((onLine->MarkValue() & mask) != 0))
-			return iLine;
+	Sci::Line lineNext = -1;
+	for (int markerNum = 0; markerNum <= Scintilla::MarkerMax; markerNum++) {
+		const MarkerLines *lines = LinesOfNumber(markerNum);
+		if (lines && (mask & MaskFromNumber(markerNum))) {
+			const Sci::Line index = lines->IndexFromLine(lineStart);
+			if (index < lines->Count()) {
+				const Sci::Line line = lines->LineFromIndex(index);
+				if ((lineNext < 0) || (line < lineNext)) {
+					lineNext = line;
+				}
+			}
+		}
 	}
-	return -1;
+	return lineNext;
+}
+
+Sci::Line LineMarkers::MarkerPrevious(Sci::Line lineStart, int mask) const noexcept {
+	if (lineStart < 0)
+		return -1;
+	Sci::Line linePrevious = -1;
+	for (int markerNum = 0; markerNum <= Scintilla::MarkerMax; markerNum++) {
+		const MarkerLines *lines = LinesOfNumber(markerNum);
+		if (lines && (mask & MaskFromNumber(markerNum))) {
+			// Index before the first line after lineStart
+			const Sci::Line index = lines->IndexFromLine(lineStart + 1) - 1;
+			if (index >= 0) {
+				linePrevious = std::max(linePrevious, lines->LineFromIndex(index));
+			}
+		}
+	}
+	return linePrevious;
 }
 
 int LineMarkers::AddMark(Sci::Line line, int markerNum, Sci::Line lines) {
@@ -174,7 +403,7 @@ int LineMarkers::AddMark(Sci::Line line, int markerNum, Sci::Line lines) {
 		// No existing markers so allocate one element per line
 		markers.InsertEmpty(0, lines);
 	}
-	if (line >= markers.Length()) {
+	if ((line >= markers.Length()) || (markerNum < 0) || (markerNum > Scintilla::MarkerMax)) {
 		return -1;
 	}
 	if (!markers[line]) {
@@ -182,6 +411,19 @@ int LineMarkers::AddMark(Sci::Line line, int markerNum, Sci::Line lines) {
 		markers[line] = std::make_unique<MarkerHandleSet>();
 	}
 	markers[line]->InsertHandle(handleCurrent, markerNum);
+	if (!numberLines[markerNum]) {
+		numberLines[markerNum] = std::make_unique<MarkerLines>(markers.Length());
+	}
+	MarkerLines *linesOfNumber = numberLines[markerNum].get();
+	Sci::Line index = linesOfNumber->IndexFromLine(line);
+	bool relabelled = false;
+	if ((index >= linesOfNumber->Count()) || (linesOfNumber->LineFromIndex(index) != line)) {
+		relabelled = linesOfNumber->Insert(index, line);
+	}
+	handleLocations[handleCurrent] = {markerNum, linesOfNumber->Label(index)};
+	if (relabelled) {
+		LocateHandles(markerNum);
+	}
 
 	return handleCurrent;
 }
@@ -191,24 +433,58 @@ bool LineMarkers::DeleteMark(Sci::Line line, int markerNum, bool all) {
 	if (markers.Length() && (line >= 0) && (line < markers.Length()) && markers[line]) {
 		if (markerNum == -1) {
 			someChanges = true;
+			const int mask = markers[line]->MarkValue();
+			ForgetHandles(markers[line].get());
 			markers[line].reset();
+			for (int number = 0; number <= Scintilla::MarkerMax; number++) {
+				if (mask & MaskFromNumber(number)) {
+					NumberRemoved(line, number);
+				}
+			}
 		} else {
+			// Forget every handle of markerNum then restore those retained when !all
+			std::uint64_t label = 0;
+			for (const MarkerHandleNumber &mhn : *markers[line]) {
+				if (mhn.number == markerNum) {
+					label = handleLocations[mhn.handle].label;
+					handleLocations.erase(mhn.handle);
+				}
+			}
 			someChanges = markers[line]->RemoveNumber(markerNum, all);
+			for (const MarkerHandleNumber &mhn : *markers[line]) {
+				if (mhn.number == markerNum) {
+					handleLocations[mhn.handle] = {markerNum, label};
+				}
+			}
 			if (markers[line]->Empty()) {
 				markers[line].reset();
 			}
+			NumberRemoved(line, markerNum);
 		}
 	}
 	return someChanges;
 }
 
+bool LineMarkers::DeleteAllMarks(int markerNum) {
+	bool someChanges = false;
+	const int mask = MaskFromNumber(markerNum);
+	for (Sci::Line line = MarkerNext(0, mask); line >= 0; line = MarkerNext(line + 1, mask)) {
+		if (DeleteMark(line, markerNum, true))
+			someChanges = true;
+	}
+	return someChanges;
+}
+
 void LineMarkers::DeleteMarkFromHandle(int markerHandle) {
 	const Sci::Line line = LineFromHandle(markerHandle);
 	if (line >= 0) {
+		const int markerNum = handleLocations[markerHandle].number;
 		markers[line]->RemoveHandle(markerHandle);
+		handleLocations.erase(markerHandle);
 		if (markers[line]->Empty()) {
 			markers[line].reset();
 		}
+		NumberRemoved(line, markerNum);
 	}
 }
 
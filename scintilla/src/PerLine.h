@@ -7,9 +7,13 @@
 // The License.txt file describes the conditions under which this software may be distributed.
 
 #include <SplitVector.h>
-#include <forward_list>
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include "CellBuffer.h"
+#include "Partitioning.h"
 #include "scintilla_globals.h"
 
 namespace Scintilla::Internal {
@@ -26,12 +30,16 @@ struct SCINTILLA_EXPORT MarkerHandleNumber {
 
 /**
  * A marker handle set contains any number of MarkerHandleNumbers.
+ * Stored contiguously with the most recently inserted at the back.
  */
 class SCINTILLA_EXPORT MarkerHandleSet {
-  std::forward_list<MarkerHandleNumber> mhList;
+  std::vector<MarkerHandleNumber> mhList;
 
 public:
   MarkerHandleSet();
+  using const_iterator = std::vector<MarkerHandleNumber>::const_iterator;
+  const_iterator begin() const noexcept { return mhList.cbegin(); }
+  const_iterator end() const noexcept { return mhList.cend(); }
   bool Empty() const noexcept;
   int MarkValue() const noexcept; ///< Bit set of marker numbers.
   bool Contains(int handle) const noexcept;
@@ -42,10 +50,49 @@ public:
   MarkerHandleNumber const *GetMarkerHandleNumber(int which) const noexcept;
 };
 
+/**
+ * The lines holding one marker number in ascending order, moved along as lines are inserted and removed.
+ * Each line also has an order label which does not change when other lines are added or removed
+ * so a marker handle can find its line again with a binary search.
+ */
+class SCINTILLA_EXPORT MarkerLines {
+  /// Partition i+1 starts at the i'th line and the last partition ends at the number of lines.
+  Partitioning<Sci::Line> starts;
+  SplitVector<std::uint64_t> labels;
+  void Relabel() noexcept;
+
+public:
+  explicit MarkerLines(Sci::Line lines);
+  Sci::Line Count() const noexcept;
+  Sci::Line LineFromIndex(Sci::Line index) const noexcept;
+  Sci::Line IndexFromLine(Sci::Line line) const noexcept; ///< First index at or after line.
+  bool Contains(Sci::Line line) const noexcept;
+  std::uint64_t Label(Sci::Line index) const noexcept;
+  Sci::Line IndexFromLabel(std::uint64_t label) const noexcept;
+  bool Insert(Sci::Line index, Sci::Line line); ///< Returns true if all labels changed.
+  void Remove(Sci::Line index);
+  void SetLine(Sci::Line index, Sci::Line line);
+  void Shift(Sci::Line line, Sci::Line delta) noexcept;
+};
+
 class SCINTILLA_EXPORT LineMarkers : public PerLine {
   SplitVector<std::unique_ptr<MarkerHandleSet>> markers;
   /// Handles are allocated sequentially and should never have to be reused as 32 bit ints are very big.
   int handleCurrent;
+  /// Marker number and order label of the line of each handle.
+  struct HandleLocation {
+    int number;
+    std::uint64_t label;
+  };
+  std::unordered_map<int, HandleLocation> handleLocations;
+  /// Lines holding each marker number, allocated when the number is first used.
+  /// Used to find the line of a handle and to skip lines without matching markers when searching.
+  std::array<std::unique_ptr<MarkerLines>, Scintilla::MarkerMax + 1> numberLines;
+  MarkerLines *LinesOfNumber(int markerNum) const noexcept;
+  void LocateHandles(int markerNum);
+  void NumberRemoved(Sci::Line line, int markerNum);
+  void ForgetHandles(const MarkerHandleSet *onLine) noexcept;
+  void ShiftLines(Sci::Line line, Sci::Line delta) noexcept;
 
 public:
   LineMarkers() : handleCurrent(0) {}
@@ -56,9 +103,11 @@ public:
 
   int MarkValue(Sci::Line line) const noexcept;
   Sci::Line MarkerNext(Sci::Line lineStart, int mask) const noexcept;
+  Sci::Line MarkerPrevious(Sci::Line lineStart, int mask) const noexcept;
   int AddMark(Sci::Line line, int markerNum, Sci::Line lines);
   void MergeMarkers(Sci::Line line);
   bool DeleteMark(Sci::Line line, int markerNum, bool all);
+  bool DeleteAllMarks(int markerNum);
   void DeleteMarkFromHandle(int markerHandle);
   Sci::Line LineFromHandle(int markerHandle) const noexcept;
   int HandleFromLine(Sci::Line line, int which) const noexcept;
@@ -54,6 +54,7 @@
 #include "DBCS.h"
 #include "Selection.h"
 #include "PositionCache.h"
+#include "ProfileCounters.h"
 
 using namespace Scintilla;
 using namespace Scintilla::Internal;
@@ -647,6 +648,78 @@ std::shared_ptr<LineLayout> LineLayoutCache::Retrieve(Sci::Line lineNumber, Sci:
 	return std::make_shared<LineLayout>(lineNumber, maxChars);
 }
 
+LineRasterCache::LineRasterCache() noexcept :
+	enabled(false), xStart(0), width(0), height(0), clock(0) {
+}
+
+void LineRasterCache::SetEnabled(bool enabled_) noexcept {
+	enabled = enabled_;
+	if (!enabled) {
+		Clear();
+	}
+}
+
+void LineRasterCache::Clear() noexcept {
+	rasters.clear();
+}
+
+void LineRasterCache::SetGeometry(int xStart_, int width_, int height_) noexcept {
+	if ((xStart != xStart_) || (width != width_) || (height != height_)) {
+		xStart = xStart_;
+		width = width_;
+		height = height_;
+		Clear();
+	}
+	// Each paint is a new use so that rasters not drawn recently are discarded first
+	clock++;
+}
+
+void LineRasterCache::InvalidateLines(Sci::Line lineFirst, Sci::Line lineLast) noexcept {
+	if (rasters.empty() || (lineLast < lineFirst)) {
+		return;
+	}
+	const auto itFirst = rasters.lower_bound({ lineFirst, 0 });
+	const auto itEnd = rasters.lower_bound({ lineLast + 1, 0 });
+	rasters.erase(itFirst, itEnd);
+}
+
+LineRaster *LineRasterCache::Find(Sci::Line line, int subLine) noexcept {
+	const auto it = rasters.find({ line, subLine });
+	if (it == rasters.end()) {
+		return nullptr;
+	}
+	it->second.lastUse = clock;
+	return &it->second;
+}
+
+LineRaster *LineRasterCache::Add(Sci::Line line, int subLine, std::unique_ptr<Surface> surface) {
+	LineRaster &raster = rasters[{ line, subLine }];
+	raster.surface = std::move(surface);
+	raster.widthLine = 0;
+	raster.lastUse = clock;
+	return &raster;
+}
+
+void LineRasterCache::Trim(size_t rastersMax) {
+	if (rasters.size() <= rastersMax) {
+		return;
+	}
+	// Partition by age once instead of searching for the oldest raster for each one removed
+	std::vector<decltype(rasters)::iterator> byAge;
+	byAge.reserve(rasters.size());
+	for (auto it = rasters.begin(); it != rasters.end(); ++it) {
+		byAge.push_back(it);
+	}
+	const size_t removals = rasters.size() - rastersMax;
+	std::nth_element(byAge.begin(), byAge.begin() + removals - 1, byAge.end(),
+		[](const auto &a, const auto &b) noexcept {
+			return a->second.lastUse < b->second.lastUse;
+		});
+	for (size_t i = 0; i < removals; i++) {
+		rasters.erase(byAge[i]);
+	}
+}
+
 namespace {
 
 // Simply pack the (maximum 4) character bytes into an int
@@ -1015,6 +1088,7 @@ class PositionCache : public IPositionCache {
 	std::mutex mutex;
 	uint16_t clock;
 	bool allClear;
+	ProfileCounters *profile;
 public:
 	PositionCache();
 	// Deleted so LineAnnotation objects can not be copied.
@@ -1029,6 +1103,7 @@ public:
 	size_t GetSize() const noexcept override;
 	void MeasureWidths(Surface *surface, const ViewStyle &vstyle, unsigned int styleNumber,
 		bool unicode, std::string_view sv, XYPOSITION *positions, bool needsLocking) override;
+	void SetProfile(ProfileCounters *profile_) noexcept override;
 };
 
 PositionCacheEntry::PositionCacheEntry() noexcept :
@@ -1104,6 +1179,7 @@ PositionCache::PositionCache() {
 	clock = 1;
 	pces.resize(0x400);
 	allClear = true;
+	profile = nullptr;
 }
 
 void PositionCache::Clear() noexcept {
@@ -1150,11 +1226,12 @@ void PositionCache::MeasureWidths(Surface *surface, const ViewStyle &vstyle, uns
 		if (needsLocking) {
 			guard.lock();
 		}
-		if (pces[probe].Retrieve(styleNumber, unicode, sv, positions)) {
-			return;
-		}
 		const size_t probe2 = (hashValue * 37) % pces.size();
-		if (pces[probe2].Retrieve(styleNumber, unicode, sv, positions)) {
+		if (pces[probe].Retrieve(styleNumber, unicode, sv, positions) ||
+			pces[probe2].Retrieve(styleNumber, unicode, sv, positions)) {
+			if (profile) {
+				profile->Add(ProfileCounter::PositionCacheHits, 1);
+			}
 			return;
 		}
 		// Not found. Choose the oldest of the two slots to replace
@@ -1163,6 +1240,9 @@ void PositionCache::MeasureWidths(Surface *surface, const ViewStyle &vstyle, uns
 		}
 	}
 
+	if (profile) {
+		profile->Add(ProfileCounter::MeasuredRuns, 1);
+	}
 	const Font *fontStyle = style.font.get();
 	if (unicode) {
 		surface->MeasureWidthsUTF8(fontStyle, sv, positions);
@@ -1189,6 +1269,10 @@ void PositionCache::MeasureWidths(Surface *surface, const ViewStyle &vstyle, uns
 	}
 }
 
+void PositionCache::SetProfile(ProfileCounters *profile_) noexcept {
+	profile = profile_;
+}
+
 std::unique_ptr<IPositionCache> Scintilla::Internal::CreatePositionCache() {
 	return std::make_unique<PositionCache>();
 }
@@ -15,6 +15,8 @@
 
 namespace Scintilla::Internal {
 
+class ProfileCounters;
+
 /**
  * A point in document space.
  * Uses double for sufficient resolution in large (>20,000,000 line) documents.
@@ -177,6 +179,38 @@ public:
                                        Sci::Line linesOnScreen, Sci::Line linesInDoc);
 };
 
+// The image of a drawn line, as wide as the window and one line high.
+struct SCINTILLA_EXPORT LineRaster {
+  std::unique_ptr<Surface> surface;
+  XYPOSITION widthLine = 0;
+  uint64_t lastUse = 0;
+};
+
+// Keeps the images of recently drawn lines so that scrolling only draws newly exposed lines.
+// Images are found by document line and subline and are only valid for the geometry they were
+// drawn with so are all discarded when that changes. Everything else that affects the drawing
+// of a line is expected to invalidate the line through InvalidateLines.
+class SCINTILLA_EXPORT LineRasterCache {
+  bool enabled;
+  int xStart;
+  int width;
+  int height;
+  uint64_t clock;
+  std::map<std::pair<Sci::Line, int>, LineRaster> rasters;
+
+public:
+  LineRasterCache() noexcept;
+  void SetEnabled(bool enabled_) noexcept;
+  bool Enabled() const noexcept { return enabled; }
+  void Clear() noexcept;
+  void SetGeometry(int xStart_, int width_, int height_) noexcept;
+  void InvalidateLines(Sci::Line lineFirst, Sci::Line lineLast) noexcept;
+  LineRaster *Find(Sci::Line line, int subLine) noexcept;
+  LineRaster *Add(Sci::Line line, int subLine, std::unique_ptr<Surface> surface);
+  void Trim(size_t rastersMax);
+  size_t Count() const noexcept { return rasters.size(); }
+};
+
 class SCINTILLA_EXPORT Representation {
 public:
   static constexpr size_t maxLength = 200;
@@ -268,6 +302,8 @@ public:
   virtual size_t GetSize() const noexcept = 0;
   virtual void MeasureWidths(Surface *surface, const ViewStyle &vstyle, unsigned int styleNumber, bool unicode,
                              std::string_view sv, XYPOSITION *positions, bool needsLocking) = 0;
+  // Count cache hits and measured runs into profile which may be nullptr
+  virtual void SetProfile(ProfileCounters *profile_) noexcept = 0;
 };
 
 SCINTILLA_EXPORT std::unique_ptr<IPositionCache> CreatePositionCache();
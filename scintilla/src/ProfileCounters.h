@@ -0,0 +1,77 @@
+#pragma once
+// Scintilla source code edit control
+/** @file ProfileCounters.h
+ ** Counts the work done for painting, layout and styling.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include "ElapsedPeriod.h"
+#include "ScintillaTypes.h"
+#include "scintilla_globals.h"
+
+namespace Scintilla::Internal {
+
+// Always counting so applications can read the costs of rendering at any time.
+// Layout may run on several threads so the counters are atomic but only need relaxed ordering
+// as they are independent totals. Durations are summed in nanoseconds so that many short
+// periods are not lost to rounding, then reported in microseconds.
+class SCINTILLA_EXPORT ProfileCounters {
+  static constexpr size_t countersSize = static_cast<size_t>(Scintilla::ProfileCounter::IdleTime) + 1;
+  std::array<std::atomic<int64_t>, countersSize> counters{};
+
+public:
+  void Add(Scintilla::ProfileCounter counter, int64_t amount) noexcept {
+    counters[static_cast<size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+  }
+  /// Add a duration in seconds, rounded to the nearest nanosecond
+  void AddDuration(Scintilla::ProfileCounter counter, double seconds) noexcept {
+    Add(counter, static_cast<int64_t>(seconds * 1.0e9 + 0.5));
+  }
+  static constexpr bool IsDuration(Scintilla::ProfileCounter counter) noexcept {
+    switch (counter) {
+    case Scintilla::ProfileCounter::PaintTime:
+    case Scintilla::ProfileCounter::LayoutTime:
+    case Scintilla::ProfileCounter::WrapTime:
+    case Scintilla::ProfileCounter::IdleTime:
+      return true;
+    default:
+      return false;
+    }
+  }
+  /// Return a count or a duration in microseconds
+  int64_t Get(Scintilla::ProfileCounter counter) const noexcept {
+    const size_t index = static_cast<size_t>(counter);
+    if (index >= countersSize) {
+      return 0;
+    }
+    const int64_t value = counters[index].load(std::memory_order_relaxed);
+    return IsDuration(counter) ? value / 1000 : value;
+  }
+  void Reset() noexcept {
+    for (std::atomic<int64_t> &counter : counters) {
+      counter.store(0, std::memory_order_relaxed);
+    }
+  }
+};
+
+// Adds the time until it goes out of scope to a duration counter, so covers every return path.
+class SCINTILLA_EXPORT ProfileDuration {
+  ProfileCounters &profile;
+  Scintilla::ProfileCounter counter;
+  ElapsedPeriod ep;
+
+public:
+  ProfileDuration(ProfileCounters &profile_, Scintilla::ProfileCounter counter_) noexcept
+      : profile(profile_), counter(counter_) {}
+  // Deleted so ProfileDuration objects can not be copied.
+  ProfileDuration(const ProfileDuration &) = delete;
+  ProfileDuration(ProfileDuration &&) = delete;
+  void operator=(const ProfileDuration &) = delete;
+  void operator=(ProfileDuration &&) = delete;
+  ~ProfileDuration() { profile.AddDuration(counter, ep.Duration()); }
+};
+
+} // namespace Scintilla::Internal
@@ -41,6 +41,10 @@ public:
   DISTANCE EndRun(DISTANCE position) const noexcept;
   // Returns changed=true if some values may have changed
   FillResult<DISTANCE> FillRange(DISTANCE position, STYLE value, DISTANCE fillLength);
+  // Fill several ranges, each with members position, fillLength and value.
+  // Ranges sorted by position without overlaps are merged into the runs in one pass.
+  // Returned range covers every range that may have changed.
+  template <typename FILL> FillResult<DISTANCE> FillRanges(const FILL *fills, size_t count);
   void SetValueAt(DISTANCE position, STYLE value);
   void InsertSpace(DISTANCE position, DISTANCE insertLength);
   void DeleteAll();
@@ -53,10 +57,12 @@ public:
   void Check() const;
 };
 
+#include <algorithm>
 #include <climits>
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
+#include <vector>
 #include "Partitioning.h"
 #include "RunStyles.h"
 #include "SplitVector.h"
@@ -210,6 +216,127 @@ Scintilla::Internal::RunStyles<DISTANCE, STYLE>::FillRange(DISTANCE position, ST
   }
 }
 
+template <typename DISTANCE, typename STYLE>
+template <typename FILL>
+Scintilla::Internal::FillResult<DISTANCE>
+Scintilla::Internal::RunStyles<DISTANCE, STYLE>::FillRanges(const FILL *fills, size_t count) {
+  FillResult<DISTANCE> result{false, 0, 0};
+  DISTANCE changeEnd = 0;
+  const auto addChange = [&result, &changeEnd](DISTANCE position, DISTANCE end) {
+    if (!result.changed) {
+      result.changed = true;
+      result.position = position;
+      changeEnd = end;
+    } else {
+      result.position = std::min(result.position, position);
+      changeEnd = std::max(changeEnd, end);
+    }
+  };
+  const DISTANCE length = Length();
+  const auto valid = [length](DISTANCE position, DISTANCE end) noexcept {
+    return (position >= 0) && (position < end) && (end <= length);
+  };
+
+  bool sorted = true;
+  DISTANCE endPrevious = 0;
+  for (size_t i = 0; i < count; i++) {
+    const DISTANCE position = static_cast<DISTANCE>(fills[i].position);
+    const DISTANCE end = position + static_cast<DISTANCE>(fills[i].fillLength);
+    if (valid(position, end)) {
+      if (position < endPrevious) {
+        sorted = false;
+        break;
+      }
+      endPrevious = end;
+    }
+  }
+  if (!sorted) {
+    // Unordered or overlapping so later ranges win as if filled separately
+    for (size_t i = 0; i < count; i++) {
+      const FillResult<DISTANCE> fr = FillRange(static_cast<DISTANCE>(fills[i].position),
+                                                static_cast<STYLE>(fills[i].value),
+                                                static_cast<DISTANCE>(fills[i].fillLength));
+      if (fr.changed) {
+        addChange(fr.position, fr.position + fr.fillLength);
+      }
+    }
+    result.fillLength = changeEnd - result.position;
+    return result;
+  }
+
+  // Merge the existing runs with the fills into new arrays
+  std::vector<DISTANCE> runStarts;
+  std::vector<STYLE> runStyles;
+  runStarts.reserve(starts.Partitions() + count * 2);
+  runStyles.reserve(starts.Partitions() + count * 2);
+  const auto append = [&runStarts, &runStyles](DISTANCE position, STYLE value) {
+    if (!runStarts.empty() && (runStarts.back() == position)) {
+      // Previous run would be empty so replace its value
+      runStyles.back() = value;
+      if ((runStyles.size() > 1) && (runStyles[runStyles.size() - 2] == value)) {
+        runStarts.pop_back();
+        runStyles.pop_back();
+      }
+    } else if (runStyles.empty() || (runStyles.back() != value)) {
+      runStarts.push_back(position);
+      runStyles.push_back(value);
+    }
+  };
+
+  DISTANCE run = 0;
+  append(0, styles.ValueAt(0));
+  for (size_t i = 0; i < count; i++) {
+    const DISTANCE position = static_cast<DISTANCE>(fills[i].position);
+    const DISTANCE end = position + static_cast<DISTANCE>(fills[i].fillLength);
+    if (!valid(position, end)) {
+      continue;
+    }
+    const STYLE value = static_cast<STYLE>(fills[i].value);
+    // Copy runs that start before this fill
+    while (starts.PositionFromPartition(run + 1) <= position) {
+      run++;
+      append(starts.PositionFromPartition(run), styles.ValueAt(run));
+    }
+    // Skip runs covered by this fill
+    bool differs = styles.ValueAt(run) != value;
+    while (starts.PositionFromPartition(run + 1) < end) {
+      run++;
+      differs = differs || (styles.ValueAt(run) != value);
+    }
+    if (differs) {
+      addChange(position, end);
+    }
+    append(position, value);
+    if (end < length) {
+      if (starts.PositionFromPartition(run + 1) == end) {
+        run++;
+      }
+      append(end, styles.ValueAt(run));
+    }
+  }
+  if (!result.changed) {
+    return result;
+  }
+  while (run + 1 < starts.Partitions()) {
+    run++;
+    append(starts.PositionFromPartition(run), styles.ValueAt(run));
+  }
+
+  const DISTANCE runsNew = static_cast<DISTANCE>(runStarts.size());
+  Partitioning<DISTANCE> startsNew(8);
+  startsNew.ReAllocate(runsNew + 1);
+  startsNew.InsertText(0, length);
+  startsNew.InsertPartitions(1, runStarts.data() + 1, runsNew - 1);
+  SplitVector<STYLE> stylesNew;
+  stylesNew.ReAllocate(runsNew + 1);
+  stylesNew.InsertFromArray(0, runStyles.data(), 0, runsNew);
+  stylesNew.InsertValue(runsNew, 1, STYLE());
+  starts = std::move(startsNew);
+  styles = std::move(stylesNew);
+  result.fillLength = changeEnd - result.position;
+  return result;
+}
+
 template <typename DISTANCE, typename STYLE>
 void Scintilla::Internal::RunStyles<DISTANCE, STYLE>::SetValueAt(DISTANCE position, STYLE value) {
   FillRange(position, value, 1);
@@ -123,10 +123,27 @@ void ScaledVector::PushBack() {
 	bytes.resize(bytes.size() + element.size);
 }
 
+void ScaledVector::DropFront(size_t length) {
+	const size_t dropped = length * element.size;
+	bytes.erase(bytes.begin(), bytes.begin() + dropped);
+	// Release memory when most of the vector was discarded
+	if (dropped > bytes.size()) {
+		bytes.shrink_to_fit();
+	}
+}
+
+void ScaledVector::ShrinkToFit() {
+	bytes.shrink_to_fit();
+}
+
 size_t ScaledVector::SizeInBytes() const noexcept {
 	return bytes.size();
 }
 
+size_t ScaledVector::CapacityInBytes() const noexcept {
+	return bytes.capacity();
+}
+
 UndoActionType::UndoActionType() noexcept : at(ActionType::insert), mayCoalesce(false) {
 }
 
@@ -151,10 +168,33 @@ void UndoActions::Clear() noexcept {
 	lengths.Clear();
 }
 
+void UndoActions::DropFront(size_t length) {
+	types.erase(types.begin(), types.begin() + length);
+	if (length > types.size()) {
+		types.shrink_to_fit();
+	}
+	positions.DropFront(length);
+	lengths.DropFront(length);
+}
+
+void UndoActions::ShrinkToFit() {
+	types.shrink_to_fit();
+	positions.ShrinkToFit();
+	lengths.ShrinkToFit();
+}
+
 intptr_t UndoActions::SSize() const noexcept {
 	return types.size();
 }
 
+size_t UndoActions::SizeInBytes() const noexcept {
+	return types.size() * sizeof(UndoActionType) + positions.SizeInBytes() + lengths.SizeInBytes();
+}
+
+size_t UndoActions::CapacityInBytes() const noexcept {
+	return types.capacity() * sizeof(UndoActionType) + positions.CapacityInBytes() + lengths.CapacityInBytes();
+}
+
 void UndoActions::Create(size_t index, ActionType at_, Sci::Position position_, Sci::Position lenData_, bool mayCoalesce_) {
 	types[index].at = at_;
 	types[index].mayCoalesce = mayCoalesce_;
@@ -186,6 +226,7 @@ Sci::Position UndoActions::Length(int action) const noexcept {
 
 void ScrapStack::Clear() noexcept {
 	stack.clear();
+	start = 0;
 	current = 0;
 }
 
@@ -198,8 +239,30 @@ const char *ScrapStack::Push(const char *text, size_t length) {
 	return stack.data() + current - length;
 }
 
+void ScrapStack::DropFront(size_t length) {
+	start += length;
+	if (start > stack.length() / 2) {
+		ShrinkToFit();
+	}
+}
+
+void ScrapStack::ShrinkToFit() {
+	stack.erase(0, start);
+	current -= start;
+	start = 0;
+	stack.shrink_to_fit();
+}
+
+size_t ScrapStack::Size() const noexcept {
+	return stack.length() - start;
+}
+
+size_t ScrapStack::Capacity() const noexcept {
+	return stack.capacity();
+}
+
 void ScrapStack::SetCurrent(size_t position) noexcept {
-	current = position;
+	current = start + position;
 }
 
 void ScrapStack::MoveForward(size_t length) noexcept {
@@ -209,7 +272,7 @@ void ScrapStack::MoveForward(size_t length) noexcept {
 }
 
 void ScrapStack::MoveBack(size_t length) noexcept {
-	if (current >= length) {
+	if (current >= start + length) {
 		current -= length;
 	}
 }
@@ -219,7 +282,7 @@ const char *ScrapStack::CurrentText() const noexcept {
 }
 
 const char *ScrapStack::TextAt(size_t position) const noexcept {
-	return stack.data() + position;
+	return stack.data() + start + position;
 }
 
 // The undo history stores a sequence of user operations that represent the user's view of the
@@ -328,6 +391,14 @@ const char *UndoHistory::AppendAction(ActionType at, Sci::Position position, con
 	}
 	actions.Create(currentAction, at, position, lengthData, mayCoalesce);
 	currentAction++;
+	// Only check when a new user operation starts as the previous operation can then be discarded
+	if (startSequence && memoryLimit && (MemoryUse() > memoryLimit)) {
+		EnforceMemoryLimit();
+		// Discarding text may have moved the scraps
+		if (dataNew) {
+			dataNew = scraps->CurrentText() - lengthData;
+		}
+	}
 	return dataNew;
 }
 
@@ -367,6 +438,77 @@ int UndoHistory::Actions() const noexcept {
 	return static_cast<int>(actions.SSize());
 }
 
+void UndoHistory::SetMemoryLimit(size_t limit) {
+	const bool lowered = (limit != 0) && ((memoryLimit == 0) || (limit < memoryLimit));
+	memoryLimit = limit;
+	EnforceMemoryLimit();
+	// Memory kept for a longer history is returned when the limit is reduced
+	if (lowered) {
+		actions.ShrinkToFit();
+		scraps->ShrinkToFit();
+	}
+}
+
+size_t UndoHistory::MemoryLimit() const noexcept {
+	return memoryLimit;
+}
+
+size_t UndoHistory::MemoryUse() const noexcept {
+	return scraps->Size() + actions.SizeInBytes();
+}
+
+size_t UndoHistory::MemoryCapacity() const noexcept {
+	return scraps->Capacity() + actions.CapacityInBytes();
+}
+
+void UndoHistory::DropFront(int actionsDrop) {
+	scraps->DropFront(actions.LengthTo(actionsDrop));
+	actions.DropFront(actionsDrop);
+	currentAction -= actionsDrop;
+	if (savePoint >= actionsDrop) {
+		savePoint -= actionsDrop;
+	} else if (savePoint >= 0) {
+		// Save point discarded so can no longer return to saved state and the
+		// whole remaining history is detached from it
+		savePoint = -1;
+		detach = 0;
+	}
+	if (detach) {
+		detach = std::max(*detach - actionsDrop, 0);
+	}
+	memory = {};
+}
+
+void UndoHistory::EnforceMemoryLimit() {
+	// Only discard complete user operations and never the current one so that the
+	// most recent change can always be undone. Tentative input may be rolled back
+	// to its start so the history is left alone while it is active.
+	if ((memoryLimit == 0) || TentativeActive() || (MemoryUse() <= memoryLimit)) {
+		return;
+	}
+	// Reduce below the limit so that discarding is not repeated for each action
+	const size_t target = memoryLimit - memoryLimit / 8;
+	const int keep = currentAction - StartUndo();
+	if (keep <= 0) {
+		return;
+	}
+	const size_t bytesPerAction = actions.SizeInBytes() / actions.types.size();
+	size_t use = MemoryUse();
+	int drop = 0;
+	while ((drop < keep) && (use > target)) {
+		// Discard the whole operation starting at drop which must end by keep
+		int act = drop;
+		do {
+			use -= actions.Length(act) + bytesPerAction;
+			act++;
+		} while (act < keep && actions.types[act - 1].mayCoalesce);
+		drop = act;
+	}
+	if (drop > 0) {
+		DropFront(drop);
+	}
+}
+
 void UndoHistory::SetSavePoint(int action) noexcept {
 	savePoint = action;
 }
@@ -38,9 +38,12 @@ public:
   void Truncate(size_t length) noexcept;
   void ReSize(size_t length);
   void PushBack();
+  void DropFront(size_t length);
+  void ShrinkToFit();
 
   // For testing
   [[nodiscard]] size_t SizeInBytes() const noexcept;
+  [[nodiscard]] size_t CapacityInBytes() const noexcept;
 };
 
 class SCINTILLA_EXPORT UndoActionType {
@@ -59,7 +62,11 @@ struct SCINTILLA_EXPORT UndoActions {
   void Truncate(size_t length) noexcept;
   void PushBack();
   void Clear() noexcept;
+  void DropFront(size_t length);
+  void ShrinkToFit();
   [[nodiscard]] intptr_t SSize() const noexcept;
+  [[nodiscard]] size_t SizeInBytes() const noexcept;
+  [[nodiscard]] size_t CapacityInBytes() const noexcept;
   void Create(size_t index, ActionType at_, Sci::Position position_, Sci::Position lenData_, bool mayCoalesce_);
   [[nodiscard]] bool AtStart(size_t index) const noexcept;
   [[nodiscard]] size_t LengthTo(size_t index) const noexcept;
@@ -67,13 +74,20 @@ struct SCINTILLA_EXPORT UndoActions {
   [[nodiscard]] Sci::Position Length(int action) const noexcept;
 };
 
+// Text discarded from the front of the stack is only removed from memory once it is more than half
+// the stack so that repeatedly discarding a little text does not move all the remaining text each time.
 class SCINTILLA_EXPORT ScrapStack {
   std::string stack;
+  size_t start = 0;
   size_t current = 0;
 
 public:
   void Clear() noexcept;
   const char *Push(const char *text, size_t length);
+  void DropFront(size_t length);
+  void ShrinkToFit();
+  [[nodiscard]] size_t Size() const noexcept;
+  [[nodiscard]] size_t Capacity() const noexcept;
   void SetCurrent(size_t position) noexcept;
   void MoveForward(size_t length) noexcept;
   void MoveBack(size_t length) noexcept;
@@ -96,8 +110,11 @@ class SCINTILLA_EXPORT UndoHistory {
     size_t position;
   };
   std::optional<actPos> memory;
+  size_t memoryLimit = 0;
 
   int PreviousAction() const noexcept;
+  void DropFront(int actionsDrop);
+  void EnforceMemoryLimit();
 
 public:
   UndoHistory();
@@ -113,6 +130,13 @@ public:
 
   [[nodiscard]] int Actions() const noexcept;
 
+  /// When the memory used by the history is over a non-zero limit, the oldest user operations
+  /// are discarded. The most recent user operation is always kept so that it can be undone.
+  void SetMemoryLimit(size_t limit);
+  [[nodiscard]] size_t MemoryLimit() const noexcept;
+  [[nodiscard]] size_t MemoryUse() const noexcept;
+  [[nodiscard]] size_t MemoryCapacity() const noexcept;
+
   /// The save point is a marker in the undo stack where the container has stated that
   /// the buffer was saved. Undo and redo can move over the save point.
   void SetSavePoint(int action) noexcept;
@@ -6,10 +6,30 @@
 // The License.txt file describes the conditions under which this software may be distributed.
 
 #include <cstdlib>
+#include <cstdint>
+#include <cstring>
 
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64)
+// SSE2 is always available on x64 and AVX2 is checked for at run time
+#define UTF8_X64_KERNELS
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(UTF8_X64_KERNELS) && (defined(__GNUC__) || defined(__clang__))
+#define UTF8_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define UTF8_TARGET_AVX2
+#endif
 
 #include "UniConversion.h"
 
@@ -115,10 +135,258 @@ void UTF8FromUTF32Character(int uch, char *putf) noexcept {
 	putf[k] = '\0';
 }
 
-size_t UTF16Length(std::string_view svu8) noexcept {
+namespace {
+
+// Length of the run of ASCII bytes at the start of sv
+inline size_t AsciiRunLength(std::string_view sv) noexcept {
+	size_t run = 0;
+#if defined(UTF8_X64_KERNELS)
+	while (run + sizeof(__m128i) <= sv.length()) {
+		const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(sv.data() + run));
+		const unsigned int nonASCII = _mm_movemask_epi8(block);
+		if (nonASCII) {
+			return run + std::countr_zero(nonASCII);
+		}
+		run += sizeof(__m128i);
+	}
+#endif
+	constexpr uint64_t highBits = 0x8080808080808080ULL;
+	uint64_t word = 0;
+	while (run + sizeof(word) <= sv.length()) {
+		memcpy(&word, sv.data() + run, sizeof(word));
+		if (word & highBits) {
+			break;
+		}
+		run += sizeof(word);
+	}
+	while ((run < sv.length()) && UTF8IsAscii(sv[run])) {
+		run++;
+	}
+	return run;
+}
+
+#if defined(UTF8_X64_KERNELS)
+
+bool ProcessorHasAVX2() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+	int info[4]{};
+	__cpuid(info, 0);
+	if (info[0] < 7) {
+		return false;
+	}
+	__cpuid(info, 1);
+	constexpr int osxsave = 1 << 27;
+	constexpr int avx = 1 << 28;
+	if ((info[2] & (osxsave | avx)) != (osxsave | avx)) {
+		return false;
+	}
+	// Operating system saves the SSE and AVX registers
+	if ((_xgetbv(0) & 0x6) != 0x6) {
+		return false;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#else
+
+constexpr bool ProcessorHasAVX2() noexcept {
+	return false;
+}
+
+#endif
+
+std::atomic<UTF8Kernels> &KernelsSelected() noexcept {
+	static std::atomic<UTF8Kernels> kernels(ProcessorHasAVX2() ? UTF8Kernels::AVX2 : UTF8Kernels::Portable);
+	return kernels;
+}
+
+#if defined(UTF8_X64_KERNELS)
+
+// Strings shorter than a vector are left to the portable kernels
+constexpr size_t vectorBytes = sizeof(__m256i);
+
+// Validation follows Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction
+// Per Byte", 2021: each byte and the byte before it index 3 nibble tables whose entries
+// are sets of the errors that the nibble allows. Any error left after and-ing the sets,
+// or a mismatch with whether a byte must continue a 3 or 4 byte sequence, is invalid.
+constexpr uint8_t tooShort = 1 << 0;	// Lead byte followed by a lead or ASCII byte
+constexpr uint8_t tooLong = 1 << 1;		// ASCII byte followed by a trail byte
+constexpr uint8_t overlong3 = 1 << 2;
+constexpr uint8_t tooLarge = 1 << 3;
+constexpr uint8_t surrogate = 1 << 4;
+constexpr uint8_t overlong2 = 1 << 5;
+constexpr uint8_t tooLarge1000 = 1 << 6;
+constexpr uint8_t overlong4 = 1 << 6;
+constexpr uint8_t twoTrails = 1 << 7;	// Matches the sign bit used for must-continue
+constexpr uint8_t carry = tooShort | tooLong | twoTrails;
+
+constexpr uint8_t byte1High[16] = {
+	// 0___ ASCII
+	tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+	// 10__ trail
+	twoTrails, twoTrails, twoTrails, twoTrails,
+	// 1100, 1101, 1110, 1111 leads
+	tooShort | overlong2,
+	tooShort,
+	tooShort | overlong3 | surrogate,
+	tooShort | tooLarge | tooLarge1000 | overlong4,
+};
+
+constexpr uint8_t byte1Low[16] = {
+	carry | overlong3 | overlong2 | overlong4,
+	carry | overlong2,
+	carry,
+	carry,
+	carry | tooLarge,
+	carry | tooLarge | tooLarge1000,
+	carry | tooLarge | tooLarge1000,
+	carry | tooLarge | tooLarge1000,
+	carry | tooLarge | tooLarge1000,
+	carry | tooLarge | tooLarge1000,
+	carry | tooLarge | tooLarge1000,
+	carry | tooLarge | tooLarge1000,
+	carry | tooLarge | tooLarge1000,
+	carry | tooLarge | tooLarge1000 | surrogate,
+	carry | tooLarge | tooLarge1000,
+	carry | tooLarge | tooLarge1000,
+};
+
+constexpr uint8_t byte2High[16] = {
+	// 0___ ASCII
+	tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+	// 1000, 1001, 1010, 1011 trail
+	tooLong | overlong2 | twoTrails | overlong3 | tooLarge1000 | overlong4,
+	tooLong | overlong2 | twoTrails | overlong3 | tooLarge,
+	tooLong | overlong2 | twoTrails | surrogate | tooLarge,
+	tooLong | overlong2 | twoTrails | surrogate | tooLarge,
+	// 11__ lead
+	tooShort, tooShort, tooShort, tooShort,
+};
+
+// Largest value of each of the last 3 bytes of a block that does not start an
+// incomplete sequence.
+constexpr uint8_t maxEnding[vectorBytes] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1,
+};
+
+UTF8_TARGET_AVX2 inline __m256i Broadcast16(const uint8_t *table) noexcept {
+	return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(table)));
+}
+
+UTF8_TARGET_AVX2 inline __m256i Splat(uint8_t value) noexcept {
+	return _mm256_set1_epi8(static_cast<char>(value));
+}
+
+UTF8_TARGET_AVX2 inline __m256i HighNibbles(__m256i bytes) noexcept {
+	return _mm256_and_si256(_mm256_srli_epi16(bytes, 4), Splat(0x0F));
+}
+
+// Non-zero bytes where the block is invalid UTF-8 or may contain a sequence that
+// UTF8Classify treats as a non-character: *FFFE, *FFFF (?? BF BE, ?? BF BF) and FDD0 .. FDEF
+// (EF B7 ??). Candidates are rare in real text and are resolved by the reference code.
+UTF8_TARGET_AVX2 __m256i BlockProblemsAVX2(__m256i input, __m256i previous) noexcept {
+	const __m256i joined = _mm256_permute2x128_si256(previous, input, 0x21);
+	const __m256i prev1 = _mm256_alignr_epi8(input, joined, 15);
+	const __m256i prev2 = _mm256_alignr_epi8(input, joined, 14);
+	const __m256i prev3 = _mm256_alignr_epi8(input, joined, 13);
+
+	const __m256i lowNibble = Splat(0x0F);
+	const __m256i special = _mm256_and_si256(
+		_mm256_and_si256(
+			_mm256_shuffle_epi8(Broadcast16(byte1High), HighNibbles(prev1)),
+			_mm256_shuffle_epi8(Broadcast16(byte1Low), _mm256_and_si256(prev1, lowNibble))),
+		_mm256_shuffle_epi8(Broadcast16(byte2High), HighNibbles(input)));
+
+	// Bytes 2 or 3 after a 3 or 4 byte lead must be trail bytes which special marks with twoTrails
+	const __m256i isThird = _mm256_subs_epu8(prev2, Splat(0xE0 - 0x80));
+	const __m256i isFourth = _mm256_subs_epu8(prev3, Splat(0xF0 - 0x80));
+	const __m256i mustContinue = _mm256_and_si256(_mm256_or_si256(isThird, isFourth), Splat(0x80));
+	const __m256i errors = _mm256_xor_si256(mustContinue, special);
+
+	const __m256i candidateFFFx = _mm256_and_si256(
+		_mm256_cmpeq_epi8(prev1, Splat(0xBF)),
+		_mm256_cmpeq_epi8(_mm256_or_si256(input, Splat(0x01)), Splat(0xBF)));
+	const __m256i candidateFDDx = _mm256_and_si256(
+		_mm256_cmpeq_epi8(prev1, Splat(0xEF)),
+		_mm256_cmpeq_epi8(input, Splat(0xB7)));
+	return _mm256_or_si256(errors, _mm256_or_si256(candidateFFFx, candidateFDDx));
+}
+
+struct UTF8Census {
+	// When clean, the text is valid without any non-characters and the counts are exact
+	bool clean = false;
+	size_t trailBytes = 0;
+	size_t fourByteLeads = 0;
+};
+
+UTF8_TARGET_AVX2 UTF8Census CensusAVX2(std::string_view svu8) noexcept {
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i maxValues = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(maxEnding));
+	__m256i previous = zero;
+	__m256i previousIncomplete = zero;
+	__m256i problems = zero;
+	UTF8Census census;
+	// The final block is padded with NULs which also reveal a truncated last character
+	alignas(vectorBytes) char tail[vectorBytes]{};
+	for (size_t position = 0;; position += vectorBytes) {
+		const bool last = position + vectorBytes > svu8.length();
+		__m256i input;
+		if (last) {
+			const size_t remaining = svu8.length() - position;
+			memcpy(tail, svu8.data() + position, remaining);
+			input = _mm256_load_si256(reinterpret_cast<const __m256i *>(tail));
+		} else {
+			input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(svu8.data() + position));
+		}
+		if (_mm256_movemask_epi8(input) == 0) {
+			// ASCII so only need to check the previous block ended with a complete character
+			problems = _mm256_or_si256(problems, previousIncomplete);
+			previousIncomplete = zero;
+		} else {
+			problems = _mm256_or_si256(problems, BlockProblemsAVX2(input, previous));
+			previousIncomplete = _mm256_subs_epu8(input, maxValues);
+			// Trail bytes 80 .. BF are less than C0 when treated as signed.
+			// The NUL padding of the final block counts as neither.
+			const unsigned int trails = _mm256_movemask_epi8(_mm256_cmpgt_epi8(Splat(0xC0), input));
+			const unsigned int fourLeads = _mm256_movemask_epi8(
+				_mm256_cmpeq_epi8(_mm256_max_epu8(input, Splat(0xF0)), input));
+			census.trailBytes += std::popcount(trails);
+			census.fourByteLeads += std::popcount(fourLeads);
+		}
+		previous = input;
+		if (last) {
+			break;
+		}
+	}
+	census.clean = _mm256_testz_si256(problems, problems);
+	return census;
+}
+
+bool UseAVX2(std::string_view svu8) noexcept {
+	return (svu8.length() >= vectorBytes) &&
+		(KernelsSelected().load(std::memory_order_relaxed) == UTF8Kernels::AVX2);
+}
+
+#endif
+
+template <bool skipASCII>
+size_t UTF16LengthBytes(std::string_view svu8) noexcept {
 	size_t ulen = 0;
 	for (size_t i = 0; i< svu8.length();) {
 		const unsigned char ch = svu8[i];
+		if constexpr (skipASCII) {
+			if (UTF8IsAscii(ch)) {
+				const size_t run = AsciiRunLength(svu8.substr(i));
+				i += run;
+				ulen += run;
+				continue;
+			}
+		}
 		const unsigned int byteCount = UTF8BytesOfLead[ch];
 		const unsigned int utf16Len = UTF16LengthFromUTF8ByteCount(byteCount);
 		i += byteCount;
@@ -133,10 +401,23 @@ constexpr unsigned char TrailByteValue(unsigned char c) {
 	return c & 0b0011'1111;
 }
 
-size_t UTF16FromUTF8(std::string_view svu8, wchar_t *tbuf, size_t tlen) {
+template <bool skipASCII>
+size_t UTF16FromUTF8Bytes(std::string_view svu8, wchar_t *tbuf, size_t tlen) {
 	size_t ui = 0;
 	for (size_t i = 0; i < svu8.length();) {
 		unsigned char ch = svu8[i];
+		if constexpr (skipASCII) {
+			if (UTF8IsAscii(ch) && (ui < tlen)) {
+				// Widening a run of ASCII is a simple loop that compilers vectorise
+				const size_t run = std::min(AsciiRunLength(svu8.substr(i)), tlen - ui);
+				for (size_t k = 0; k < run; k++) {
+					tbuf[ui + k] = static_cast<unsigned char>(svu8[i + k]);
+				}
+				i += run;
+				ui += run;
+				continue;
+			}
+		}
 		const unsigned int byteCount = UTF8BytesOfLead[ch];
 		unsigned int value;
 
@@ -192,10 +473,19 @@ size_t UTF16FromUTF8(std::string_view svu8, wchar_t *tbuf, size_t tlen) {
 	return ui;
 }
 
-size_t UTF32Length(std::string_view svu8) noexcept {
+template <bool skipASCII>
+size_t UTF32LengthBytes(std::string_view svu8) noexcept {
 	size_t ulen = 0;
 	for (size_t i = 0; i < svu8.length();) {
 		const unsigned char ch = svu8[i];
+		if constexpr (skipASCII) {
+			if (UTF8IsAscii(ch)) {
+				const size_t run = AsciiRunLength(svu8.substr(i));
+				i += run;
+				ulen += run;
+				continue;
+			}
+		}
 		const unsigned int byteCount = UTF8BytesOfLead[ch];
 		i += byteCount;
 		ulen++;
@@ -203,10 +493,22 @@ size_t UTF32Length(std::string_view svu8) noexcept {
 	return ulen;
 }
 
-size_t UTF32FromUTF8(std::string_view svu8, unsigned int *tbuf, size_t tlen) {
+template <bool skipASCII>
+size_t UTF32FromUTF8Bytes(std::string_view svu8, unsigned int *tbuf, size_t tlen) {
 	size_t ui = 0;
 	for (size_t i = 0; i < svu8.length();) {
 		unsigned char ch = svu8[i];
+		if constexpr (skipASCII) {
+			if (UTF8IsAscii(ch) && (ui < tlen)) {
+				const size_t run = std::min(AsciiRunLength(svu8.substr(i)), tlen - ui);
+				for (size_t k = 0; k < run; k++) {
+					tbuf[ui + k] = static_cast<unsigned char>(svu8[i + k]);
+				}
+				i += run;
+				ui += run;
+				continue;
+			}
+		}
 		const unsigned int byteCount = UTF8BytesOfLead[ch];
 		unsigned int value;
 
@@ -256,6 +558,95 @@ size_t UTF32FromUTF8(std::string_view svu8, unsigned int *tbuf, size_t tlen) {
 	return ui;
 }
 
+template <bool skipASCII>
+bool UTF8IsValidBytes(std::string_view svu8) noexcept {
+	const char *s = svu8.data();
+	size_t remaining = svu8.length();
+	while (remaining > 0) {
+		if constexpr (skipASCII) {
+			if (UTF8IsAscii(*s)) {
+				const size_t run = AsciiRunLength(std::string_view(s, remaining));
+				s += run;
+				remaining -= run;
+				continue;
+			}
+		}
+		const int utf8Status = UTF8Classify(s, remaining);
+		if (utf8Status & UTF8MaskInvalid) {
+			return false;
+		}
+		const int lenChar = utf8Status & UTF8MaskWidth;
+		s += lenChar;
+		remaining -= lenChar;
+	}
+	return true;
+}
+
+}
+
+UTF8Kernels UTF8KernelsActive() noexcept {
+	return KernelsSelected().load(std::memory_order_relaxed);
+}
+
+bool SetUTF8Kernels(UTF8Kernels kernels) noexcept {
+	if ((kernels == UTF8Kernels::AVX2) && !ProcessorHasAVX2()) {
+		return false;
+	}
+	KernelsSelected().store(kernels, std::memory_order_relaxed);
+	return true;
+}
+
+size_t UTF16Length(std::string_view svu8) noexcept {
+#if defined(UTF8_X64_KERNELS)
+	if (UseAVX2(svu8)) {
+		// Each character is 1 unit except those from 4 byte sequences which are 2
+		const UTF8Census census = CensusAVX2(svu8);
+		if (census.clean) {
+			return svu8.length() - census.trailBytes + census.fourByteLeads;
+		}
+		return UTF16LengthBytes<false>(svu8);
+	}
+#endif
+	return UTF16LengthBytes<true>(svu8);
+}
+
+size_t UTF16LengthReference(std::string_view svu8) noexcept {
+	return UTF16LengthBytes<false>(svu8);
+}
+
+size_t UTF16FromUTF8(std::string_view svu8, wchar_t *tbuf, size_t tlen) {
+	return UTF16FromUTF8Bytes<true>(svu8, tbuf, tlen);
+}
+
+size_t UTF16FromUTF8Reference(std::string_view svu8, wchar_t *tbuf, size_t tlen) {
+	return UTF16FromUTF8Bytes<false>(svu8, tbuf, tlen);
+}
+
+size_t UTF32Length(std::string_view svu8) noexcept {
+#if defined(UTF8_X64_KERNELS)
+	if (UseAVX2(svu8)) {
+		const UTF8Census census = CensusAVX2(svu8);
+		if (census.clean) {
+			return svu8.length() - census.trailBytes;
+		}
+		return UTF32LengthBytes<false>(svu8);
+	}
+#endif
+	return UTF32LengthBytes<true>(svu8);
+}
+
+size_t UTF32LengthReference(std::string_view svu8) noexcept {
+	return UTF32LengthBytes<false>(svu8);
+}
+
+size_t UTF32FromUTF8(std::string_view svu8, unsigned int *tbuf, size_t tlen) {
+	return UTF32FromUTF8Bytes<true>(svu8, tbuf, tlen);
+}
+
+size_t UTF32FromUTF8Reference(std::string_view svu8, unsigned int *tbuf, size_t tlen) {
+	return UTF32FromUTF8Bytes<false>(svu8, tbuf, tlen);
+}
+
 std::wstring WStringFromUTF8(std::string_view svu8) {
 	if constexpr (sizeof(wchar_t) == 2) {
 		const size_t len16 = UTF16Length(svu8);
@@ -367,26 +758,35 @@ int UTF8DrawBytes(const char *s, size_t len) noexcept {
 }
 
 bool UTF8IsValid(std::string_view svu8) noexcept {
-	const char *s = svu8.data();
-	size_t remaining = svu8.length();
-	while (remaining > 0) {
-		const int utf8Status = UTF8Classify(s, remaining);
-		if (utf8Status & UTF8MaskInvalid) {
-			return false;
-		}
-		const int lenChar = utf8Status & UTF8MaskWidth;
-		s += lenChar;
-		remaining -= lenChar;
+#if defined(UTF8_X64_KERNELS)
+	if (UseAVX2(svu8)) {
+		return CensusAVX2(svu8).clean || UTF8IsValidBytes<false>(svu8);
 	}
-	return true;
+#endif
+	return UTF8IsValidBytes<true>(svu8);
+}
+
+bool UTF8IsValidReference(std::string_view svu8) noexcept {
+	return UTF8IsValidBytes<false>(svu8);
 }
 
 // Replace invalid bytes in UTF-8 with the replacement character
 std::string FixInvalidUTF8(const std::string &text) {
+	if (UTF8IsValid(text)) {
+		return text;
+	}
 	std::string result;
+	result.reserve(text.size());
 	const char *s = text.c_str();
 	size_t remaining = text.size();
 	while (remaining > 0) {
+		if (UTF8IsAscii(*s)) {
+			const size_t run = AsciiRunLength(std::string_view(s, remaining));
+			result.append(s, run);
+			s += run;
+			remaining -= run;
+			continue;
+		}
 		const int utf8Status = UTF8Classify(s, remaining);
 		if (utf8Status & UTF8MaskInvalid) {
 			// Replacement character 0xFFFD = UTF8:"efbfbd".
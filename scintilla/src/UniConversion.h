@@ -30,6 +30,21 @@ SCINTILLA_EXPORT unsigned int UTF16FromUTF32Character(unsigned int val, wchar_t
 SCINTILLA_EXPORT bool UTF8IsValid(std::string_view svu8) noexcept;
 SCINTILLA_EXPORT std::string FixInvalidUTF8(const std::string &text);
 
+// The length, validation and conversion functions skip runs of ASCII many bytes at a time.
+// On x64 processors with AVX2 they also validate and count 32 bytes at a time.
+// Kernels are chosen from the processor's features on first use and may be
+// changed for testing and benchmarking: SetUTF8Kernels fails if they are unsupported.
+enum class UTF8Kernels { Portable, AVX2 };
+SCINTILLA_EXPORT UTF8Kernels UTF8KernelsActive() noexcept;
+SCINTILLA_EXPORT bool SetUTF8Kernels(UTF8Kernels kernels) noexcept;
+
+// Byte-at-a-time implementations that the kernels are tested against
+SCINTILLA_EXPORT size_t UTF16LengthReference(std::string_view svu8) noexcept;
+SCINTILLA_EXPORT size_t UTF16FromUTF8Reference(std::string_view svu8, wchar_t *tbuf, size_t tlen);
+SCINTILLA_EXPORT size_t UTF32LengthReference(std::string_view svu8) noexcept;
+SCINTILLA_EXPORT size_t UTF32FromUTF8Reference(std::string_view svu8, unsigned int *tbuf, size_t tlen);
+SCINTILLA_EXPORT bool UTF8IsValidReference(std::string_view svu8) noexcept;
+
 SCINTILLA_EXPORT extern const unsigned char UTF8BytesOfLead[256];
 
 inline int UnicodeFromUTF8(const unsigned char *us) noexcept {
@@ -17,10 +17,12 @@
 #include <array>
 #include <map>
 #include <set>
+#include <tuple>
 #include <optional>
 #include <algorithm>
 #include <memory>
 #include <numeric>
+#include <mutex>
 
 #include "ScintillaTypes.h"
 
@@ -100,6 +102,35 @@ void FontRealised::Realise(Surface &surface, int zoomLevel, Technology technolog
 	}
 }
 
+std::shared_ptr<FontRealised> FontRealisedCache::Realise(Surface &surface, int zoomLevel, Technology technology,
+	const FontSpecification &fs, const char *localeName) {
+	// The resolution of the surface is included as it changes the size of fonts
+	const Key key(fs.fontName, fs.size, fs.weight, fs.italic, fs.characterSet, fs.extraFontFlag, fs.checkMonospaced,
+		zoomLevel, technology, localeName, surface.LogPixelsY());
+	std::lock_guard<std::mutex> guard(mutex);
+	const auto it = fonts.find(key);
+	if (it != fonts.end()) {
+		if (std::shared_ptr<FontRealised> fr = it->second.lock()) {
+			return fr;
+		}
+	}
+	std::erase_if(fonts, [](const auto &item) noexcept { return item.second.expired(); });
+	std::shared_ptr<FontRealised> fr = std::make_shared<FontRealised>();
+	fr->Realise(surface, zoomLevel, technology, fs, localeName);
+	fonts[key] = fr;
+	return fr;
+}
+
+size_t FontRealisedCache::Count() {
+	std::lock_guard<std::mutex> guard(mutex);
+	return std::count_if(fonts.cbegin(), fonts.cend(), [](const auto &item) noexcept { return !item.second.expired(); });
+}
+
+FontRealisedCache &FontRealisedCache::Shared() {
+	static FontRealisedCache cache;
+	return cache;
+}
+
 ViewStyle::ViewStyle(size_t stylesSize_) :
 	styles(stylesSize_),
 	markers(MarkerMax + 1),
@@ -370,7 +401,9 @@ void ViewStyle::CalculateMarginWidthAndMask() noexcept {
 }
 
 void ViewStyle::Refresh(Surface &surface, int tabInChars) {
-	fonts.clear();
+	// Keep the current fonts alive until the new set is realised so unchanged fonts are reused
+	FontMap fontsPrevious;
+	fonts.swap(fontsPrevious);
 
 	selbar = Platform::Chrome();
 	selbarlight = Platform::ChromeHighlight();
@@ -386,9 +419,9 @@ void ViewStyle::Refresh(Surface &surface, int tabInChars) {
 		CreateAndAddFont(style);
 	}
 
-	// Ask platform to allocate each unique font.
-	for (const std::pair<const FontSpecification, std::unique_ptr<FontRealised>> &font : fonts) {
-		font.second->Realise(surface, zoomLevel, technology, font.first, localeName.c_str());
+	// Ask platform to allocate each unique font or share one already allocated.
+	for (std::pair<const FontSpecification, std::shared_ptr<FontRealised>> &font : fonts) {
+		font.second = FontRealisedCache::Shared().Realise(surface, zoomLevel, technology, font.first, localeName.c_str());
 	}
 
 	// Set the platform font handle and measurements for each style.
@@ -774,12 +807,12 @@ void ViewStyle::CreateAndAddFont(const FontSpecification &fs) {
 	if (fs.fontName) {
 		const FontMap::iterator it = fonts.find(fs);
 		if (it == fonts.end()) {
-			fonts[fs] = std::make_unique<FontRealised>();
+			fonts[fs] = {};
 		}
 	}
 }
 
-FontRealised *ViewStyle::Find(const FontSpecification &fs) {
+const FontRealised *ViewStyle::Find(const FontSpecification &fs) {
 	if (!fs.fontName)	// Invalid specification so return arbitrary object
 		return fonts.begin()->second.get();
 	const FontMap::iterator it = fonts.find(fs);
@@ -8,7 +8,10 @@
 // The License.txt file describes the conditions under which this software may be distributed.
 
 #include <map>
+#include <mutex>
 #include <set>
+#include <string>
+#include <tuple>
 #include "Indicator.h"
 #include "LineMarker.h"
 #include "Platform.h"
@@ -37,7 +40,23 @@ public:
                const char *localeName);
 };
 
-typedef std::map<FontSpecification, std::unique_ptr<FontRealised>> FontMap;
+typedef std::map<FontSpecification, std::shared_ptr<FontRealised>> FontMap;
+
+// Views with the same styles share realised fonts and their measurements so that each platform font
+// is created and measured once per process instead of once per view on every refresh.
+// Only weak references are held so fonts are released when no view uses them.
+class SCINTILLA_EXPORT FontRealisedCache {
+  using Key = std::tuple<std::string, int, Scintilla::FontWeight, bool, Scintilla::CharacterSet, Scintilla::FontQuality,
+                         bool, int, Scintilla::Technology, std::string, int>;
+  std::mutex mutex;
+  std::map<Key, std::weak_ptr<FontRealised>> fonts;
+
+public:
+  std::shared_ptr<FontRealised> Realise(Surface &surface, int zoomLevel, Scintilla::Technology technology,
+                                        const FontSpecification &fs, const char *localeName);
+  size_t Count();
+  static FontRealisedCache &Shared();
+};
 
 using ColourOptional = std::optional<ColourRGBA>;
 
@@ -250,7 +269,7 @@ public:
 private:
   void AllocStyles(size_t sizeNew);
   void CreateAndAddFont(const FontSpecification &fs);
-  FontRealised *Find(const FontSpecification &fs);
+  const FontRealised *Find(const FontSpecification &fs);
   void FindMaxAscentDescent() noexcept;
 };
 } // namespace Scintilla::Internal
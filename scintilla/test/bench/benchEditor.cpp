@@ -0,0 +1,404 @@
+// @file benchEditor.cpp - Headless benchmarks of a complete Scintilla editor
+//
+// Drives ScintillaEditBase through its message interface with no window so it can run on CI
+// machines with QT_QPA_PLATFORM=offscreen. Replaces the Windows-only Python performance tests.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdio>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QPainter>
+
+#include "ScintillaEditBase.h"
+#include "Lexilla.h"
+
+namespace {
+
+constexpr int editorWidth = 800;
+constexpr int editorHeight = 600;
+
+struct Options {
+  double scale = 1.0;
+  int repeats = 3;
+  std::string filter;
+  std::string file;
+  std::string report;
+};
+
+struct Result {
+  std::string name;
+  size_t operations = 0;
+  double seconds = 0.0;
+};
+
+// An editor sized like a typical view with UTF-8 text and a source file to work on.
+class Editor {
+  ScintillaEditBase edit;
+
+public:
+  Editor() {
+    edit.setSize(QSizeF(editorWidth, editorHeight));
+    Send(SCI_SETCODEPAGE, SC_CP_UTF8);
+  }
+
+  sptr_t Send(unsigned int message, uptr_t wParam = 0, sptr_t lParam = 0) { return edit.send(message, wParam, lParam); }
+
+  sptr_t Send(unsigned int message, uptr_t wParam, std::string_view sv) {
+    return edit.send(message, wParam, reinterpret_cast<sptr_t>(sv.data()));
+  }
+
+  void SetText(std::string_view text) {
+    Send(SCI_CLEARALL);
+    Send(SCI_APPENDTEXT, text.length(), text);
+    Send(SCI_EMPTYUNDOBUFFER);
+  }
+
+  void SetCppLexer() {
+    Send(SCI_SETILEXER, 0, reinterpret_cast<sptr_t>(CreateLexer("cpp")));
+    Send(SCI_SETKEYWORDS, 0, std::string_view("if else for while return int void char const struct"));
+    Send(SCI_SETPROPERTY, reinterpret_cast<uptr_t>("fold"), std::string_view("1"));
+  }
+
+  // Paints the whole view into an image as the scene graph would.
+  void Paint(QImage &image) {
+    QPainter painter(&image);
+    static_cast<QQuickPaintedItem &>(edit).paint(&painter);
+  }
+};
+
+// Synthesise C-like source with nested blocks to fold, some long lines to wrap and words to find.
+std::string SynthesiseSource(size_t lines) {
+  std::string text;
+  size_t line = 0;
+  int function = 0;
+  while (line < lines) {
+    const std::string name = "function" + std::to_string(function++);
+    text += "// " + name + " returns the sum of its arguments after checking each of them against the limit"
+            " which is longer than the view so wraps\n";
+    text += "int " + name + "(int a, int b) {\n";
+    text += "\tint total = 0;\n";
+    text += "\tfor (int i = 0; i < a; i++) {\n";
+    text += "\t\tif (i % 3 == 0) {\n";
+    text += "\t\t\ttotal += b * i; /* \xcf\x86 */\n";
+    text += "\t\t}\n";
+    text += "\t}\n";
+    text += "\treturn total;\n";
+    text += "}\n";
+    text += "\n";
+    line += 11;
+  }
+  return text;
+}
+
+std::string LoadSource(const Options &options) {
+  if (!options.file.empty()) {
+    std::ifstream ifs(options.file, std::ios::binary);
+    if (!ifs) {
+      std::cerr << "Can not read " << options.file << "\n";
+      std::exit(1);
+    }
+    return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+  }
+  return SynthesiseSource(static_cast<size_t>(100000 * options.scale) + 11);
+}
+
+size_t Scaled(const Options &options, size_t count) {
+  return std::max<size_t>(1, static_cast<size_t>(count * options.scale));
+}
+
+// The line added by the Python performance tests this replaces
+const std::string lineText = "abcdefghijklmnopqrstuvwxyz0123456789\n";
+
+// Each benchmark prepares an editor then times only the operations being measured.
+using Timed = std::function<size_t(Editor &, QElapsedTimer &)>;
+
+struct Benchmark {
+  std::string name;
+  Timed run;
+};
+
+std::vector<Benchmark> Benchmarks(const Options &options, const std::string &source) {
+  std::vector<Benchmark> benchmarks;
+
+  benchmarks.push_back({"AddLine", [&](Editor &editor, QElapsedTimer &timer) {
+    const size_t count = Scaled(options, 2000);
+    timer.start();
+    for (size_t i = 0; i < count; i++) {
+      editor.Send(SCI_ADDTEXT, lineText.length(), lineText);
+    }
+    return count;
+  }});
+
+  benchmarks.push_back({"AddLineMiddle", [&](Editor &editor, QElapsedTimer &timer) {
+    const size_t count = Scaled(options, 2000);
+    timer.start();
+    for (size_t i = 0; i < count; i++) {
+      const sptr_t middle = editor.Send(SCI_POSITIONFROMLINE, editor.Send(SCI_GETLINECOUNT) / 2);
+      editor.Send(SCI_GOTOPOS, middle);
+      editor.Send(SCI_ADDTEXT, lineText.length(), lineText);
+    }
+    return count;
+  }});
+
+  benchmarks.push_back({"Huge", [&](Editor &editor, QElapsedTimer &timer) {
+    std::string text;
+    const size_t count = Scaled(options, 100000);
+    for (size_t i = 0; i < count; i++)
+      text += lineText;
+    timer.start();
+    editor.Send(SCI_ADDTEXT, text.length(), text);
+    return count;
+  }});
+
+  benchmarks.push_back({"HugeInserts", [&](Editor &editor, QElapsedTimer &timer) {
+    const size_t count = Scaled(options, 2000);
+    timer.start();
+    for (size_t i = 0; i < count; i++) {
+      editor.Send(SCI_INSERTTEXT, 0, lineText);
+    }
+    return count;
+  }});
+
+  benchmarks.push_back({"HugeReplace", [&](Editor &editor, QElapsedTimer &timer) {
+    std::string text;
+    for (size_t i = 0; i < 100000; i++)
+      text += lineText;
+    editor.SetText(text);
+    const size_t count = Scaled(options, 1000);
+    const std::string_view replacement("1234567890");
+    timer.start();
+    for (size_t i = 0; i < count; i++) {
+      const sptr_t start = static_cast<sptr_t>(i * lineText.length());
+      editor.Send(SCI_SETTARGETRANGE, start, start + 10);
+      editor.Send(SCI_REPLACETARGET, replacement.length(), replacement);
+    }
+    return count;
+  }});
+
+  // Searches for a character only present at the end of a long document
+  const auto searchEnd = [&](int flags, size_t searches) {
+    return [&options, flags, searches](Editor &editor, QElapsedTimer &timer) {
+      std::string text;
+      for (size_t i = 0; i < 1000; i++)
+        text += lineText;
+      text += "\xcf\x86\n";
+      editor.SetText(text);
+      editor.Send(SCI_SETSEARCHFLAGS, flags);
+      const std::string_view needle("\xcf\x86");
+      const size_t count = Scaled(options, searches);
+      timer.start();
+      for (size_t i = 0; i < count; i++) {
+        editor.Send(SCI_TARGETWHOLEDOCUMENT);
+        if (editor.Send(SCI_SEARCHINTARGET, needle.length(), needle) < 0)
+          return size_t(0);
+      }
+      return count;
+    };
+  };
+  benchmarks.push_back({"UTF8CaseSearches", searchEnd(SCFIND_MATCHCASE, 1000)});
+  benchmarks.push_back({"UTF8Searches", searchEnd(0, 20)});
+
+  benchmarks.push_back({"WrapAll", [&](Editor &editor, QElapsedTimer &timer) {
+    editor.SetText(source);
+    editor.Send(SCI_SETWRAPMODE, SC_WRAP_WORD);
+    const sptr_t lines = editor.Send(SCI_GETLINECOUNT);
+    timer.start();
+    // Showing the last line needs every line before it to be wrapped
+    editor.Send(SCI_ENSUREVISIBLE, lines - 1);
+    editor.Send(SCI_VISIBLEFROMDOCLINE, lines - 1);
+    return static_cast<size_t>(lines);
+  }});
+
+  benchmarks.push_back({"ScrollPaint", [&](Editor &editor, QElapsedTimer &timer) {
+    editor.SetText(source);
+    editor.SetCppLexer();
+    QImage image(editorWidth, editorHeight, QImage::Format_ARGB32_Premultiplied);
+    const sptr_t lines = editor.Send(SCI_GETLINECOUNT);
+    const sptr_t page = std::max<sptr_t>(1, editor.Send(SCI_LINESONSCREEN));
+    size_t pages = 0;
+    timer.start();
+    for (sptr_t top = 0; top < lines; top += page) {
+      editor.Send(SCI_SETFIRSTVISIBLELINE, top);
+      editor.Paint(image);
+      pages++;
+    }
+    return pages;
+  }});
+
+  // Scroll a few lines at a time as when using the mouse wheel, painting after each step
+  const auto scrollLines = [&](bool rasterCache) {
+    return [&source, rasterCache](Editor &editor, QElapsedTimer &timer) {
+      editor.SetText(source);
+      editor.SetCppLexer();
+      editor.Send(SCI_SETLINERASTERCACHE, rasterCache);
+      QImage image(editorWidth, editorHeight, QImage::Format_ARGB32_Premultiplied);
+      const sptr_t lines = std::min<sptr_t>(editor.Send(SCI_GETLINECOUNT), 5000);
+      size_t paints = 0;
+      timer.start();
+      for (sptr_t top = 0; top < lines; top += 3) {
+        editor.Send(SCI_SETFIRSTVISIBLELINE, top);
+        editor.Paint(image);
+        paints++;
+      }
+      return paints;
+    };
+  };
+  benchmarks.push_back({"ScrollLines", scrollLines(false)});
+  benchmarks.push_back({"ScrollLinesRasterCache", scrollLines(true)});
+
+  benchmarks.push_back({"FindAll", [&](Editor &editor, QElapsedTimer &timer) {
+    editor.SetText(source);
+    editor.Send(SCI_SETSEARCHFLAGS, SCFIND_MATCHCASE | SCFIND_WHOLEWORD);
+    const std::string_view needle("total");
+    const sptr_t length = editor.Send(SCI_GETLENGTH);
+    size_t found = 0;
+    timer.start();
+    editor.Send(SCI_SETTARGETRANGE, 0, length);
+    while (editor.Send(SCI_SEARCHINTARGET, needle.length(), needle) >= 0) {
+      found++;
+      editor.Send(SCI_SETTARGETRANGE, editor.Send(SCI_GETTARGETEND), length);
+    }
+    return found;
+  }});
+
+  benchmarks.push_back({"ReplaceAll", [&](Editor &editor, QElapsedTimer &timer) {
+    editor.SetText(source);
+    editor.Send(SCI_SETSEARCHFLAGS, SCFIND_MATCHCASE | SCFIND_WHOLEWORD);
+    const std::string_view needle("total");
+    const std::string_view replacement("sum");
+    size_t replaced = 0;
+    timer.start();
+    editor.Send(SCI_BEGINUNDOACTION);
+    editor.Send(SCI_TARGETWHOLEDOCUMENT);
+    while (editor.Send(SCI_SEARCHINTARGET, needle.length(), needle) >= 0) {
+      editor.Send(SCI_REPLACETARGET, replacement.length(), replacement);
+      replaced++;
+      editor.Send(SCI_SETTARGETRANGE, editor.Send(SCI_GETTARGETEND), editor.Send(SCI_GETLENGTH));
+    }
+    editor.Send(SCI_ENDUNDOACTION);
+    return replaced;
+  }});
+
+  benchmarks.push_back({"FoldAll", [&](Editor &editor, QElapsedTimer &timer) {
+    editor.SetText(source);
+    editor.SetCppLexer();
+    editor.Send(SCI_COLOURISE, 0, -1);
+    timer.start();
+    editor.Send(SCI_FOLDALL, SC_FOLDACTION_CONTRACT);
+    editor.Send(SCI_FOLDALL, SC_FOLDACTION_EXPAND);
+    return static_cast<size_t>(editor.Send(SCI_GETLINECOUNT));
+  }});
+
+  return benchmarks;
+}
+
+std::string JSONString(std::string_view sv) {
+  std::string quoted = "\"";
+  for (const char ch : sv) {
+    if (ch == '"' || ch == '\\')
+      quoted += '\\';
+    quoted += ch;
+  }
+  return quoted + "\"";
+}
+
+void WriteReport(const Options &options, const std::vector<Result> &results) {
+  std::ofstream ofs(options.report);
+  if (!ofs) {
+    std::cerr << "Can not write " << options.report << "\n";
+    return;
+  }
+  ofs << "{\n";
+  ofs << "  \"file\": " << JSONString(options.file) << ",\n";
+  ofs << "  \"scale\": " << options.scale << ",\n";
+  ofs << "  \"repeats\": " << options.repeats << ",\n";
+  ofs << "  \"results\": [\n";
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result &result = results[i];
+    const double nsPerOperation = result.operations ? result.seconds * 1e9 / result.operations : 0.0;
+    ofs << "    {\"name\": " << JSONString(result.name) << ", \"operations\": " << result.operations
+        << ", \"seconds\": " << result.seconds << ", \"nsPerOperation\": " << nsPerOperation << "}"
+        << ((i + 1 < results.size()) ? ",\n" : "\n");
+  }
+  ofs << "  ]\n";
+  ofs << "}\n";
+}
+
+bool StartsWith(std::string_view s, std::string_view prefix) {
+  return s.substr(0, prefix.length()) == prefix;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  // Run without a display unless a platform was chosen explicitly
+  if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  QApplication app(argc, argv);
+
+  Options options;
+  const QStringList arguments = QApplication::arguments();
+  for (qsizetype i = 1; i < arguments.size(); i++) {
+    const std::string argument = arguments[i].toStdString();
+    const std::string_view arg(argument);
+    const std::string_view value = arg.substr(std::min(arg.find('=') + 1, arg.length()));
+    if (StartsWith(arg, "--scale=")) {
+      options.scale = std::strtod(std::string(value).c_str(), nullptr);
+    } else if (StartsWith(arg, "--repeats=")) {
+      options.repeats = std::max(1, std::atoi(std::string(value).c_str()));
+    } else if (StartsWith(arg, "--filter=")) {
+      options.filter = value;
+    } else if (StartsWith(arg, "--file=")) {
+      options.file = value;
+    } else if (StartsWith(arg, "--report=")) {
+      options.report = value;
+    } else {
+      std::cerr << "Usage: scintilla_bench_editor [--file=FILE] [--scale=F] [--repeats=N] [--filter=TEXT] "
+                   "[--report=FILE]\n";
+      return 1;
+    }
+  }
+
+  const std::string source = LoadSource(options);
+
+  std::vector<Result> results;
+  for (const Benchmark &benchmark : Benchmarks(options, source)) {
+    if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos)
+      continue;
+    Result result{benchmark.name, 0, 0.0};
+    for (int repeat = 0; repeat < options.repeats; repeat++) {
+      // A new editor each time so no state is carried between runs
+      Editor editor;
+      QElapsedTimer timer;
+      const size_t operations = benchmark.run(editor, timer);
+      const double seconds = timer.nsecsElapsed() / 1e9;
+      if (repeat == 0 || seconds < result.seconds) {
+        result.operations = operations;
+        result.seconds = seconds;
+      }
+    }
+    if (result.operations == 0) {
+      std::cerr << benchmark.name << " failed\n";
+      return 1;
+    }
+    std::printf("%-24s %10zu ops %12.3f ms %12.2f ns/op\n", result.name.c_str(), result.operations,
+                result.seconds * 1e3, result.seconds * 1e9 / result.operations);
+    results.push_back(result);
+  }
+
+  if (!options.report.empty())
+    WriteReport(options, results);
+  return 0;
+}
@@ -0,0 +1,628 @@
+/** @file benchScintilla.cxx
+ ** Benchmarks for Scintilla internal data structures
+ **/
+
+/*
+    Each benchmark prepares its data then times only the operations being measured.
+    Runs are repeated and the fastest kept. Random choices come from a generator seeded
+    from --seed so runs are reproducible.
+
+    Options:
+        --seed=1            seed for random positions and text
+        --scale=1           multiplier for the number of operations
+        --repeats=3         runs of each benchmark
+        --filter=Document   only run benchmarks with names containing this text
+        --report=file.json  write results as JSON
+*/
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <functional>
+#include <random>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+
+#include "ScintillaTypes.h"
+#include "ScintillaStructures.h"
+
+#include "ILoader.h"
+#include "ILexer.h"
+
+#include "Debugging.h"
+
+#include "CharacterCategoryMap.h"
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "UniqueString.h"
+#include "SparseVector.h"
+#include "CellBuffer.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "UniConversion.h"
+#include "ElapsedPeriod.h"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+namespace {
+
+using Generator = std::mt19937;
+
+struct Options {
+	unsigned int seed = 1;
+	double scale = 1.0;
+	int repeats = 3;
+	std::string filter;
+	std::string report;
+};
+
+struct Result {
+	std::string name;
+	size_t operations = 0;
+	double seconds = 0.0;
+};
+
+// A benchmark is given a generator and a count of operations then returns the
+// seconds taken by the timed part.
+using Benchmark = std::function<double(Generator &generator, size_t operations)>;
+
+size_t Uniform(Generator &generator, size_t limit) {
+	// Uniform in [0, limit)
+	return limit ? std::uniform_int_distribution<size_t>(0, limit - 1)(generator) : 0;
+}
+
+// Stops the compiler discarding calculations whose results are otherwise unused.
+volatile Sci::Position sink = 0;
+
+void Consume(Sci::Position value) noexcept {
+	sink = value;
+}
+
+// Text similar to source code: indented lines of short words and punctuation.
+std::string MakeText(Generator &generator, size_t length) {
+	static constexpr const char *words[] = {
+		"int", "return", "value", "position", "line", "if", "for", "while", "document",
+		"style", "=", "+", "(", ")", "{", "}", ";", "->", "0", "1", "lengthDocument",
+	};
+	constexpr size_t countWords = std::size(words);
+	std::string text;
+	text.reserve(length + 80);
+	while (text.length() < length) {
+		text.append(Uniform(generator, 4) * 4, ' ');
+		const size_t wordsOnLine = Uniform(generator, 10);
+		for (size_t word = 0; word < wordsOnLine; word++) {
+			text.append(words[Uniform(generator, countWords)]);
+			text.push_back(' ');
+		}
+		text.push_back('\n');
+	}
+	return text;
+}
+
+// Markup around text in a language written with 3 byte characters.
+std::string MakeTextCJK(Generator &generator, size_t length) {
+	static constexpr std::string_view pieces[] = {
+		"<p>", "</p>\n", " ", "\xE4\xB8\xAD\xE6\x96\x87", "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E", "\xE3\x80\x82",
+	};
+	std::string text;
+	while (text.length() < length) {
+		text.append(pieces[Uniform(generator, std::size(pieces))]);
+	}
+	return text;
+}
+
+void SetUpDocument(Document &doc) {
+	doc.SetDBCSCodePage(CpUtf8);
+	doc.SetCaseFolder(std::make_unique<CaseFolderUnicode>());
+}
+
+// Text encoding: operations are bytes of text
+
+double UniConversionUTF16Length(Generator &generator, size_t operations) {
+	const std::string text = MakeTextCJK(generator, operations);
+	ElapsedPeriod ep;
+	Consume(UTF16Length(text));
+	return ep.Duration();
+}
+
+double UniConversionUTF8IsValid(Generator &generator, size_t operations) {
+	const std::string text = MakeTextCJK(generator, operations);
+	ElapsedPeriod ep;
+	Consume(UTF8IsValid(text));
+	return ep.Duration();
+}
+
+double UniConversionUTF16FromUTF8(Generator &generator, size_t operations) {
+	// Source code is mostly ASCII
+	const std::string text = MakeText(generator, operations);
+	std::wstring converted(UTF16Length(text), L'\0');
+	ElapsedPeriod ep;
+	Consume(UTF16FromUTF8(text, converted.data(), converted.length()));
+	return ep.Duration();
+}
+
+// Containers
+
+Partitioning<int> MakeLines(int lines, int lineLength) {
+	Partitioning<int> part(8);
+	for (int line = 0; line < lines; line++) {
+		part.InsertText(line, lineLength);
+		part.InsertPartition(line + 1, (line + 1) * lineLength);
+	}
+	return part;
+}
+
+double SplitVectorInsertSequential(Generator &, size_t operations) {
+	SplitVector<char> sv;
+	ElapsedPeriod ep;
+	for (size_t i = 0; i < operations; i++) {
+		sv.Insert(sv.Length(), 'a');
+	}
+	return ep.Duration();
+}
+
+double SplitVectorInsertRandom(Generator &generator, size_t operations) {
+	SplitVector<char> sv;
+	sv.InsertValue(0, operations, 'a');
+	std::vector<ptrdiff_t> positions;
+	for (size_t i = 0; i < operations; i++) {
+		positions.push_back(Uniform(generator, sv.Length() + i));
+	}
+	ElapsedPeriod ep;
+	for (const ptrdiff_t position : positions) {
+		sv.Insert(position, 'b');
+	}
+	return ep.Duration();
+}
+
+double SplitVectorInsertMultiCaret(Generator &, size_t operations) {
+	// Carets spread through the vector each receive a character in turn, moving the gap each time
+	constexpr size_t carets = 100;
+	SplitVector<char> sv;
+	sv.InsertValue(0, operations * 4, 'a');
+	ElapsedPeriod ep;
+	for (size_t i = 0; i < operations / carets; i++) {
+		const ptrdiff_t spacing = sv.Length() / carets;
+		for (size_t caret = 0; caret < carets; caret++) {
+			sv.Insert(static_cast<ptrdiff_t>(caret) * (spacing + 1), 'b');
+		}
+	}
+	return ep.Duration();
+}
+
+double PartitioningPartitionFromPosition(Generator &generator, size_t operations) {
+	constexpr int lineLength = 40;
+	const int partitions = static_cast<int>(operations / 10) + 1;
+	Partitioning<int> part = MakeLines(partitions, lineLength);
+	std::vector<int> positions;
+	for (size_t i = 0; i < operations; i++) {
+		positions.push_back(static_cast<int>(Uniform(generator, partitions * lineLength)));
+	}
+	ElapsedPeriod ep;
+	for (const int position : positions) {
+		Consume(part.PartitionFromPosition(position));
+	}
+	return ep.Duration();
+}
+
+double PartitioningInsertText(Generator &generator, size_t operations) {
+	// Typing at random lines leaves a step that must be moved before the next change
+	constexpr int lineLength = 40;
+	const int partitions = static_cast<int>(operations / 10) + 1;
+	Partitioning<int> part = MakeLines(partitions, lineLength);
+	std::vector<int> lines;
+	for (size_t i = 0; i < operations; i++) {
+		lines.push_back(static_cast<int>(Uniform(generator, partitions)));
+	}
+	ElapsedPeriod ep;
+	for (const int line : lines) {
+		part.InsertText(line, 1);
+	}
+	return ep.Duration();
+}
+
+double RunStylesFillRange(Generator &generator, size_t operations) {
+	const int length = static_cast<int>(operations * 10);
+	RunStyles<int, int> rs;
+	rs.InsertSpace(0, length);
+	struct Fill {
+		int position;
+		int value;
+		int fillLength;
+	};
+	std::vector<Fill> fills;
+	for (size_t i = 0; i < operations; i++) {
+		const int position = static_cast<int>(Uniform(generator, length));
+		const int fillLength = static_cast<int>(std::min<size_t>(Uniform(generator, 50) + 1, length - position));
+		fills.push_back({ position, static_cast<int>(Uniform(generator, 8)), fillLength });
+	}
+	ElapsedPeriod ep;
+	for (const Fill &fill : fills) {
+		rs.FillRange(fill.position, fill.value, fill.fillLength);
+	}
+	return ep.Duration();
+}
+
+double SparseVectorSetValueAt(Generator &generator, size_t operations) {
+	const Sci::Position length = operations * 10;
+	SparseVector<int> sv;
+	sv.InsertSpace(0, length);
+	std::vector<Sci::Position> positions;
+	for (size_t i = 0; i < operations; i++) {
+		positions.push_back(Uniform(generator, length));
+	}
+	ElapsedPeriod ep;
+	int value = 1;
+	for (const Sci::Position position : positions) {
+		sv.SetValueAt(position, value++);
+	}
+	return ep.Duration();
+}
+
+// Document
+
+double DocumentInsertSequential(Generator &, size_t operations) {
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	ElapsedPeriod ep;
+	for (size_t i = 0; i < operations; i++) {
+		doc.InsertString(doc.Length(), (i % 40 == 39) ? "\n" : "a");
+	}
+	return ep.Duration();
+}
+
+double DocumentInsertRandom(Generator &generator, size_t operations) {
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	doc.InsertString(0, MakeText(generator, operations * 10));
+	std::vector<Sci::Position> positions;
+	for (size_t i = 0; i < operations; i++) {
+		// Text is ASCII so every position is a character boundary
+		positions.push_back(Uniform(generator, doc.Length() + i));
+	}
+	ElapsedPeriod ep;
+	for (size_t i = 0; i < operations; i++) {
+		doc.InsertString(positions[i], (i % 10 == 9) ? "\n" : "b");
+	}
+	return ep.Duration();
+}
+
+double DocumentInsertMultiCaret(Generator &generator, size_t operations) {
+	// Each round types one character at every caret as a single batched replacement
+	constexpr size_t carets = 100;
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	doc.InsertString(0, MakeText(generator, operations * 10));
+	std::vector<Sci::Position> positions;
+	for (size_t caret = 0; caret < carets; caret++) {
+		positions.push_back(doc.LineStart(doc.SciLineFromPosition(Uniform(generator, doc.Length()))));
+	}
+	std::sort(positions.begin(), positions.end());
+	ElapsedPeriod ep;
+	for (size_t round = 0; round < operations / carets; round++) {
+		std::vector<Replacement> replacements;
+		for (size_t caret = 0; caret < carets; caret++) {
+			// Each caret has moved over its own and all earlier carets' typing
+			replacements.emplace_back(positions[caret] + round * (caret + 1), 0, "c");
+		}
+		doc.ReplaceRanges(replacements);
+	}
+	return ep.Duration();
+}
+
+double DocumentLineFromPosition(Generator &generator, size_t operations) {
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	doc.InsertString(0, MakeText(generator, operations * 4));
+	std::vector<Sci::Position> positions;
+	for (size_t i = 0; i < operations; i++) {
+		positions.push_back(Uniform(generator, doc.Length()));
+	}
+	ElapsedPeriod ep;
+	for (const Sci::Position position : positions) {
+		Consume(doc.SciLineFromPosition(position));
+	}
+	return ep.Duration();
+}
+
+double DocumentMarkerEditLookUp(Generator &generator, size_t operations) {
+	// Diagnostic tooling with a marker on every 10th line while lines are added in the middle
+	// of the document and markers are found
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	doc.InsertString(0, MakeText(generator, operations * 400));
+	std::vector<int> handles;
+	for (Sci::Line line = 0; line < doc.LinesTotal(); line += 10) {
+		handles.push_back(doc.AddMark(line, static_cast<int>(line % 3)));
+	}
+	std::vector<Sci::Line> lines;
+	std::vector<int> lookUps;
+	for (size_t i = 0; i < operations; i++) {
+		lines.push_back(doc.LinesTotal() / 2 + Uniform(generator, 100));
+		lookUps.push_back(handles[Uniform(generator, handles.size())]);
+	}
+	ElapsedPeriod ep;
+	for (size_t i = 0; i < operations; i++) {
+		doc.InsertString(doc.LineStart(lines[i]), "\n");
+		Consume(doc.LineFromHandle(lookUps[i]));
+		Consume(doc.MarkerNext(lines[i], 1 << 2));
+	}
+	return ep.Duration();
+}
+
+double DocumentIndexLineStart(Generator &generator, size_t operations) {
+	// An editor allocating the UTF-16 index for a large document then editing and
+	// querying only near its top
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	doc.InsertString(0, MakeText(generator, operations * 400));
+	std::vector<Sci::Line> lines;
+	for (size_t i = 0; i < operations; i++) {
+		lines.push_back(Uniform(generator, 200));
+	}
+	ElapsedPeriod ep;
+	doc.AllocateLineCharacterIndex(LineCharacterIndexType::Utf16);
+	for (size_t i = 0; i < operations; i++) {
+		doc.InsertString(doc.LineStart(lines[i]), (i % 10 == 9) ? "\n" : "b");
+		Consume(doc.IndexLineStart(lines[i], LineCharacterIndexType::Utf16));
+	}
+	return ep.Duration();
+}
+
+double DocumentStyleFill(Generator &generator, size_t operations) {
+	// Styles the whole document in short runs as a lexer does
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	doc.InsertString(0, MakeText(generator, operations * 8));
+	std::vector<Sci::Position> runs;
+	for (Sci::Position position = 0; position < doc.Length();) {
+		const Sci::Position run = std::min<Sci::Position>(Uniform(generator, 15) + 1, doc.Length() - position);
+		runs.push_back(run);
+		position += run;
+	}
+	ElapsedPeriod ep;
+	doc.StartStyling(0);
+	char style = 0;
+	for (const Sci::Position run : runs) {
+		doc.SetStyleFor(run, style);
+		style = (style + 1) % 16;
+	}
+	return ep.Duration();
+}
+
+double DocumentDecorationFill(Generator &generator, size_t operations) {
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	doc.InsertString(0, MakeText(generator, operations * 10));
+	struct Fill {
+		Sci::Position position;
+		Sci::Position fillLength;
+		int value;
+	};
+	std::vector<Fill> fills;
+	for (size_t i = 0; i < operations; i++) {
+		const Sci::Position position = Uniform(generator, doc.Length());
+		const Sci::Position fillLength = std::min<Sci::Position>(Uniform(generator, 20) + 1, doc.Length() - position);
+		fills.push_back({ position, fillLength, (Uniform(generator, 4) == 0) ? 0 : 1 });
+	}
+	ElapsedPeriod ep;
+	doc.DecorationSetCurrentIndicator(8);
+	for (const Fill &fill : fills) {
+		doc.DecorationFillRange(fill.position, fill.value, fill.fillLength);
+	}
+	return ep.Duration();
+}
+
+double DocumentDecorationFillRanges(Generator &generator, size_t operations) {
+	// Applies a sorted set of results such as diagnostics in one call
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	doc.InsertString(0, MakeText(generator, operations * 10));
+	std::vector<IndicatorFill> fills;
+	Sci::Position position = 0;
+	for (size_t i = 0; i < operations; i++) {
+		position += Uniform(generator, 10);
+		const Sci::Position fillLength = std::min<Sci::Position>(Uniform(generator, 10) + 1, doc.Length() - position);
+		if (fillLength <= 0) {
+			break;
+		}
+		fills.push_back({ position, fillLength, static_cast<int>(Uniform(generator, 3)) + 1 });
+		position += fillLength;
+	}
+	ElapsedPeriod ep;
+	doc.DecorationSetCurrentIndicator(8);
+	doc.DecorationFillRanges(fills.data(), fills.size());
+	return ep.Duration();
+}
+
+double DocumentUndoRedo(Generator &generator, size_t operations) {
+	// Undoes then redoes a history of separate actions, half insertions and half deletions
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	doc.InsertString(0, MakeText(generator, operations * 10));
+	doc.DeleteUndoHistory();
+	for (size_t i = 0; i < operations; i++) {
+		const Sci::Position position = Uniform(generator, doc.Length() - 1);
+		doc.BeginUndoAction();
+		if (i % 2) {
+			doc.DeleteChars(position, 1);
+		} else {
+			doc.InsertString(position, "undo");
+		}
+		doc.EndUndoAction();
+	}
+	ElapsedPeriod ep;
+	while (doc.CanUndo()) {
+		doc.Undo();
+	}
+	while (doc.CanRedo()) {
+		doc.Redo();
+	}
+	return ep.Duration();
+}
+
+double DocumentFind(Generator &generator, size_t operations, FindOption flags, const char *search) {
+	// Operations are bytes searched so results are comparable between options
+	Document doc(DocumentOption::Default);
+	SetUpDocument(doc);
+	doc.InsertString(0, MakeText(generator, operations));
+	ElapsedPeriod ep;
+	Sci::Position position = 0;
+	while (position < doc.Length()) {
+		Sci::Position length = static_cast<Sci::Position>(strlen(search));
+		const Sci::Position found = doc.FindText(position, doc.Length(), search, flags, &length);
+		if (found < 0) {
+			break;
+		}
+		position = found + std::max<Sci::Position>(length, 1);
+	}
+	return ep.Duration();
+}
+
+struct Definition {
+	const char *name;
+	size_t operations;
+	Benchmark benchmark;
+};
+
+const std::vector<Definition> &Definitions() {
+	static const std::vector<Definition> definitions = {
+		{ "UniConversion.UTF16Length", 16000000, UniConversionUTF16Length },
+		{ "UniConversion.UTF8IsValid", 16000000, UniConversionUTF8IsValid },
+		{ "UniConversion.UTF16FromUTF8", 16000000, UniConversionUTF16FromUTF8 },
+		{ "SplitVector.InsertSequential", 4000000, SplitVectorInsertSequential },
+		{ "SplitVector.InsertRandom", 100000, SplitVectorInsertRandom },
+		{ "SplitVector.InsertMultiCaret", 100000, SplitVectorInsertMultiCaret },
+		{ "Partitioning.PartitionFromPosition", 1000000, PartitioningPartitionFromPosition },
+		{ "Partitioning.InsertText", 100000, PartitioningInsertText },
+		{ "RunStyles.FillRange", 50000, RunStylesFillRange },
+		{ "SparseVector.SetValueAt", 50000, SparseVectorSetValueAt },
+		{ "Document.InsertSequential", 1000000, DocumentInsertSequential },
+		{ "Document.InsertRandom", 20000, DocumentInsertRandom },
+		{ "Document.InsertMultiCaret", 50000, DocumentInsertMultiCaret },
+		{ "Document.LineFromPosition", 1000000, DocumentLineFromPosition },
+		{ "Document.MarkerEditLookUp", 10000, DocumentMarkerEditLookUp },
+		{ "Document.IndexLineStart", 10000, DocumentIndexLineStart },
+		{ "Document.StyleFill", 1000000, DocumentStyleFill },
+		{ "Document.DecorationFill", 100000, DocumentDecorationFill },
+		{ "Document.DecorationFillRanges", 50000, DocumentDecorationFillRanges },
+		{ "Document.UndoRedo", 20000, DocumentUndoRedo },
+		{ "Document.FindMatchCase", 8000000, [](Generator &generator, size_t operations) {
+			return DocumentFind(generator, operations, FindOption::MatchCase, "lengthDocument");
+		} },
+		{ "Document.FindCaseInsensitive", 8000000, [](Generator &generator, size_t operations) {
+			return DocumentFind(generator, operations, FindOption::None, "LengthDocument");
+		} },
+		{ "Document.FindRegExp", 2000000, [](Generator &generator, size_t operations) {
+			return DocumentFind(generator, operations, FindOption::RegExp, "len[a-z]+ument");
+		} },
+	};
+	return definitions;
+}
+
+std::string JSONString(std::string_view sv) {
+	std::string quoted = "\"";
+	for (const char ch : sv) {
+		if (ch == '"' || ch == '\\') {
+			quoted.push_back('\\');
+		}
+		quoted.push_back(ch);
+	}
+	quoted.push_back('"');
+	return quoted;
+}
+
+void WriteReport(std::ostream &os, const Options &options, const std::vector<Result> &results) {
+	os << "{\n";
+	os << "  \"seed\": " << options.seed << ",\n";
+	os << "  \"scale\": " << options.scale << ",\n";
+	os << "  \"repeats\": " << options.repeats << ",\n";
+	os << "  \"results\": [\n";
+	os << std::fixed;
+	for (size_t i = 0; i < results.size(); i++) {
+		const Result &result = results[i];
+		os << "    {" <<
+			"\"name\": " << JSONString(result.name) << ", " <<
+			"\"operations\": " << result.operations << ", " <<
+			"\"seconds\": " << std::setprecision(6) << result.seconds << ", " <<
+			"\"nsPerOperation\": " << std::setprecision(3) << (result.seconds * 1.0e9 / result.operations) << "}" <<
+			((i + 1 < results.size()) ? "," : "") << "\n";
+	}
+	os << "  ]\n";
+	os << "}\n";
+}
+
+std::optional<std::string_view> OptionValue(std::string_view arg, std::string_view name) {
+	if (arg.starts_with(name) && (arg.length() > name.length()) && (arg[name.length()] == '=')) {
+		return arg.substr(name.length() + 1);
+	}
+	return {};
+}
+
+}
+
+int main(int argc, char **argv) {
+	Options options;
+	for (int i = 1; i < argc; i++) {
+		const std::string_view arg = argv[i];
+		if (const auto seed = OptionValue(arg, "--seed")) {
+			options.seed = static_cast<unsigned int>(std::strtoul(seed->data(), nullptr, 10));
+		} else if (const auto scale = OptionValue(arg, "--scale")) {
+			options.scale = std::strtod(scale->data(), nullptr);
+		} else if (const auto repeats = OptionValue(arg, "--repeats")) {
+			options.repeats = std::max(std::atoi(repeats->data()), 1);
+		} else if (const auto filter = OptionValue(arg, "--filter")) {
+			options.filter = *filter;
+		} else if (const auto report = OptionValue(arg, "--report")) {
+			options.report = *report;
+		} else {
+			std::cerr << "Unknown option " << arg << "\n";
+			return 1;
+		}
+	}
+
+	std::vector<Result> results;
+	for (const Definition &definition : Definitions()) {
+		if (!options.filter.empty() && (std::string_view(definition.name).find(options.filter) == std::string_view::npos)) {
+			continue;
+		}
+		Result result{ definition.name, std::max<size_t>(static_cast<size_t>(definition.operations * options.scale), 100), 0.0 };
+		for (int repeat = 0; repeat < options.repeats; repeat++) {
+			// Same seed for each repeat so every run does the same work
+			Generator generator(options.seed);
+			const double seconds = definition.benchmark(generator, result.operations);
+			if (repeat == 0 || seconds < result.seconds) {
+				result.seconds = seconds;
+			}
+		}
+		std::cout << std::left << std::setw(36) << result.name << std::right << std::fixed <<
+			std::setw(12) << result.operations << " ops " <<
+			std::setw(10) << std::setprecision(3) << (result.seconds * 1.0e3) << " ms " <<
+			std::setw(10) << std::setprecision(2) << (result.seconds * 1.0e9 / result.operations) << " ns/op\n";
+		results.push_back(result);
+	}
+
+	if (!options.report.empty()) {
+		std::ofstream ofs(options.report);
+		if (!ofs) {
+			std::cerr << "Can not write report " << options.report << "\n";
+			return 1;
+		}
+		WriteReport(ofs, options, results);
+	}
+	return 0;
+}
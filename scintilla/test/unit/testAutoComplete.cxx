@@ -0,0 +1,143 @@
+/** @file testAutoComplete.cxx
+ ** Unit Tests for Scintilla internal data structures
+ **/
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <memory>
+
+#include "ScintillaTypes.h"
+
+#include "Debugging.h"
+#include "Geometry.h"
+#include "Platform.h"
+
+#include "Position.h"
+#include "AutoComplete.h"
+
+#include "catch.hpp"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+// Test AutoComplete.
+
+namespace {
+
+// Records the rows of the list so filtering can be checked without a window.
+class TestListBox : public ListBox {
+public:
+	std::vector<std::string> rows;
+	int selection = -1;
+	void SetFont(const Font *) override {}
+	void Create(Window &, int, Point, int, bool, Technology) override {}
+	void SetAverageCharWidth(int) override {}
+	void SetVisibleRows(int) override {}
+	int GetVisibleRows() const override { return 0; }
+	PRectangle GetDesiredRect() override { return PRectangle(); }
+	int CaretFromEdge() override { return 0; }
+	void Clear() noexcept override { rows.clear(); }
+	void Append(char *s, int) override { rows.emplace_back(s); }
+	int Length() override { return static_cast<int>(rows.size()); }
+	void Select(int n) override { selection = n; }
+	int GetSelection() override { return selection; }
+	int Find(const char *) override { return -1; }
+	std::string GetValue(int n) override { return rows.at(n); }
+	void RegisterImage(int, const char *) override {}
+	void RegisterRGBAImage(int, int, int, const unsigned char *) override {}
+	void ClearRegisteredImages() override {}
+	void SetDelegate(IListBoxDelegate *) override {}
+	void SetList(const char *list, char separator, char typesep) override {
+		rows.clear();
+		const std::string_view sv(list);
+		size_t start = 0;
+		for (;;) {
+			size_t end = sv.find(separator, start);
+			if (end == std::string_view::npos)
+				end = sv.length();
+			const std::string_view entry = sv.substr(start, end - start);
+			rows.emplace_back(entry.substr(0, entry.rfind(typesep)));
+			if (end >= sv.length())
+				break;
+			start = end + 1;
+		}
+	}
+	void SetOptions(ListOptions) override {}
+};
+
+}
+
+TEST_CASE("FuzzyScore") {
+
+	SECTION("Subsequence") {
+		REQUIRE(FuzzyScore("", "anything") == 0);
+		REQUIRE(FuzzyScore("gvl", "getValueList") > fuzzyNoMatch);
+		REQUIRE(FuzzyScore("GVL", "getValueList") > fuzzyNoMatch);
+		REQUIRE(FuzzyScore("lvg", "getValueList") == fuzzyNoMatch);
+		REQUIRE(FuzzyScore("getx", "getValueList") == fuzzyNoMatch);
+		REQUIRE(FuzzyScore("a", "") == fuzzyNoMatch);
+	}
+
+	SECTION("Ranking") {
+		// Camel-case humps beat scattered letters
+		REQUIRE(FuzzyScore("gVL", "getValueList") > FuzzyScore("gVL", "gravelList"));
+		// Word starts after punctuation
+		REQUIRE(FuzzyScore("ol", "on_load") > FuzzyScore("ol", "scroll"));
+		// Consecutive characters beat gaps
+		REQUIRE(FuzzyScore("val", "value") > FuzzyScore("val", "vertical"));
+		// Exact case is a tie breaker
+		REQUIRE(FuzzyScore("Val", "Value") > FuzzyScore("Val", "value"));
+	}
+
+	SECTION("Mask") {
+		REQUIRE(FuzzyMask("") == 0);
+		REQUIRE(FuzzyMask("abc") == FuzzyMask("CBA"));
+		const std::uint64_t maskQuery = FuzzyMask("gvl");
+		REQUIRE((FuzzyMask("getValueList") & maskQuery) == maskQuery);
+		REQUIRE((FuzzyMask("getName") & maskQuery) != maskQuery);
+	}
+
+}
+
+TEST_CASE("AutoCompleteFuzzy") {
+
+	AutoComplete ac;
+	auto lbOwned = std::make_unique<TestListBox>();
+	TestListBox *lb = lbOwned.get();
+	ac.lb = std::move(lbOwned);
+	ac.autoHide = false;
+	ac.options = AutoCompleteOption::Fuzzy;
+
+	SECTION("Filter") {
+		ac.SetList("gravelList getValue getValueList setValueList?1 value");
+		REQUIRE(lb->rows.size() == 5);
+		ac.Select("gVL");
+		REQUIRE(lb->rows == std::vector<std::string>{"getValueList", "getValue", "gravelList"});
+		REQUIRE(lb->selection == 0);
+		REQUIRE(ac.GetValue(ac.GetSelection()) == "getValueList");
+		// Extending the word only searches the previous matches
+		ac.Select("gVLi");
+		REQUIRE(lb->rows == std::vector<std::string>{"getValueList", "gravelList"});
+		ac.Select("sv");
+		REQUIRE(lb->rows == std::vector<std::string>{"setValueList"});
+		ac.Select("xyz");
+		REQUIRE(lb->selection == -1);
+		ac.Select("");
+		REQUIRE(lb->rows.size() == 5);
+		REQUIRE(lb->selection == 0);
+	}
+
+	SECTION("Prefix") {
+		ac.options = AutoCompleteOption::Normal;
+		ac.SetList("gravelList getValue getValueList value");
+		ac.Select("getV");
+		REQUIRE(lb->rows.size() == 4);
+		REQUIRE(lb->selection == 1);
+	}
+
+}
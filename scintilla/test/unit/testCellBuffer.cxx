@@ -63,6 +63,22 @@ TEST_CASE("ScrapStack") {
 		const char *text5 = ss.Push("1", 1);
 		REQUIRE(memcmp(text5, "1", 1) == 0);
 	}
+
+	SECTION("DropFrontReleasesMemory") {
+		const std::string text(10000, 'x');
+		ss.Push(text.c_str(), text.length());
+		ss.Push("abc", 3);
+		REQUIRE(ss.Capacity() >= 10003);
+		// Small drops keep the text in place
+		ss.DropFront(100);
+		REQUIRE(ss.Size() == 9903);
+		REQUIRE(ss.Capacity() >= 10003);
+		ss.DropFront(9900);
+		REQUIRE(ss.Size() == 3);
+		REQUIRE(ss.Capacity() < 1000);
+		ss.MoveBack(3);
+		REQUIRE(memcmp(ss.CurrentText(), "abc", 3) == 0);
+	}
 }
 
 TEST_CASE("CellBuffer") {
@@ -334,6 +350,17 @@ TEST_CASE("ScaledVector") {
 		REQUIRE(sv.SizeInBytes() == 4);
 		REQUIRE(sv.ValueAt(0) == 0x1fd4381);
 	}
+
+	SECTION("DropFront") {
+		sv.ReSize(3);
+		sv.SetValueAt(0, 1);
+		sv.SetValueAt(1, 0x200);
+		sv.SetValueAt(2, 3);
+		sv.DropFront(2);
+		REQUIRE(sv.Size() == 1);
+		REQUIRE(sv.SizeInBytes() == 2);
+		REQUIRE(sv.ValueAt(0) == 3);
+	}
 }
 
 TEST_CASE("UndoHistory") {
@@ -643,6 +670,119 @@ TEST_CASE("UndoHistory") {
 		REQUIRE(uh.TentativeSteps() == -1);
 		REQUIRE(uh.CanUndo());
 	}
+
+	SECTION("MemoryLimit") {
+		REQUIRE(uh.MemoryLimit() == 0);
+		REQUIRE(uh.MemoryUse() == 0);
+		bool startSequence = false;
+		for (int i = 0; i < 20; i++) {
+			if (i == 5) {
+				uh.SetSavePoint();
+			}
+			const std::string text(10, static_cast<char>('a' + i));
+			uh.AppendAction(ActionType::insert, i * 10, text.c_str(), 10, startSequence, false);
+		}
+		REQUIRE(uh.Actions() == 20);
+		const size_t use = uh.MemoryUse();
+		REQUIRE(use > 200);
+
+		// Oldest actions discarded along with the save point
+		uh.SetMemoryLimit(use / 2);
+		REQUIRE(uh.MemoryLimit() == use / 2);
+		REQUIRE(uh.MemoryUse() <= use / 2);
+		const int actions = uh.Actions();
+		REQUIRE(actions > 0);
+		REQUIRE(actions < 20);
+		REQUIRE(uh.Current() == actions);
+		REQUIRE(uh.SavePoint() == -1);
+		REQUIRE(uh.DetachPoint() == 0);
+
+		// Remaining actions undo with their own text
+		for (int i = 19; i >= 20 - actions; i--) {
+			REQUIRE(uh.CanUndo());
+			REQUIRE(uh.StartUndo() == 1);
+			const Action action = uh.GetUndoStep();
+			REQUIRE(Equal(action, ActionType::insert, i * 10, std::string(10, static_cast<char>('a' + i)).c_str()));
+			uh.CompletedUndoStep();
+		}
+		REQUIRE(!uh.CanUndo());
+		REQUIRE(uh.Text(0) == std::string(10, static_cast<char>('a' + 20 - actions)));
+	}
+
+	SECTION("MemoryLimitReleasesCapacity") {
+		bool startSequence = false;
+		const std::string text(100, 'x');
+		for (int i = 0; i < 1000; i++) {
+			uh.AppendAction(ActionType::insert, i * 100, text.c_str(), 100, startSequence, false);
+		}
+		REQUIRE(uh.MemoryCapacity() >= 100000);
+		uh.SetMemoryLimit(2000);
+		REQUIRE(uh.MemoryUse() <= 2000);
+		REQUIRE(uh.MemoryCapacity() <= 2 * 2000);
+		// Raising the limit keeps the remaining history
+		const int actions = uh.Actions();
+		uh.SetMemoryLimit(4000);
+		REQUIRE(uh.Actions() == actions);
+	}
+
+	SECTION("MemoryLimitMovesSavePoint") {
+		bool startSequence = false;
+		for (int i = 0; i < 10; i++) {
+			if (i == 8) {
+				uh.SetSavePoint();
+			}
+			const std::string text(10, static_cast<char>('a' + i));
+			uh.AppendAction(ActionType::insert, i * 10, text.c_str(), 10, startSequence, false);
+		}
+		uh.SetMemoryLimit(uh.MemoryUse() - 1);
+		const int dropped = 10 - uh.Actions();
+		REQUIRE(dropped > 0);
+		REQUIRE(dropped < 8);
+		REQUIRE(uh.SavePoint() == 8 - dropped);
+		REQUIRE(uh.DetachPoint() == -1);
+		const Action action = uh.GetUndoStep();
+		REQUIRE(Equal(action, ActionType::insert, 90, "jjjjjjjjjj"));
+		REQUIRE(uh.Text(0) == std::string(10, static_cast<char>('a' + dropped)));
+	}
+
+	SECTION("MemoryLimitKeepsCurrentOperation") {
+		bool startSequence = false;
+		uh.SetMemoryLimit(50);
+		uh.BeginUndoAction();
+		for (int i = 0; i < 20; i++) {
+			uh.AppendAction(ActionType::insert, i * 10, "0123456789", 10, startSequence, false);
+		}
+		uh.EndUndoAction();
+		// Whole of a single operation kept even though over limit
+		REQUIRE(uh.Actions() == 20);
+		REQUIRE(uh.MemoryUse() > 50);
+		REQUIRE(uh.StartUndo() == 20);
+
+		// Starting another operation allows the first to be discarded
+		uh.AppendAction(ActionType::remove, 0, "ab", 2, startSequence, false);
+		REQUIRE(startSequence);
+		REQUIRE(uh.Actions() == 1);
+		REQUIRE(uh.MemoryUse() <= 50);
+		const Action action = uh.GetUndoStep();
+		REQUIRE(Equal(action, ActionType::remove, 0, "ab"));
+
+		// No limit
+		uh.SetMemoryLimit(0);
+		REQUIRE(uh.MemoryLimit() == 0);
+	}
+
+	SECTION("MemoryLimitTentative") {
+		bool startSequence = false;
+		uh.AppendAction(ActionType::insert, 0, "0123456789", 10, startSequence, false);
+		uh.TentativeStart();
+		uh.AppendAction(ActionType::insert, 10, "0123456789", 10, startSequence, false);
+		uh.SetMemoryLimit(10);
+		// Nothing discarded while tentative
+		REQUIRE(uh.Actions() == 2);
+		TentativeUndo(uh);
+		uh.AppendAction(ActionType::insert, 10, "abc", 3, startSequence, false);
+		REQUIRE(uh.Actions() == 1);
+	}
 }
 
 TEST_CASE("UndoActions") {
@@ -954,6 +1094,84 @@ TEST_CASE("CharacterIndex") {
 		REQUIRE(cb.IndexLineStart(2, LineCharacterIndexType::Utf16) == 4);
 		REQUIRE(cb.IndexLineStart(3, LineCharacterIndexType::Utf16) == 5);
 	}
+
+	SECTION("Counted on demand") {
+		// Lines are only counted as far as queries reach so edit before, after and
+		// across the counted lines then check against counts made from the text.
+		cb.SetUTF8Substance(true);
+
+		bool startSequence = false;
+		std::string data;
+		for (int line = 0; line < 3000; line++) {
+			data += "line \xE2\x82\xAC\xF0\x90\x8D\x88 ";
+			data += std::to_string(line);
+			data += (line % 7 == 0) ? "\r\n" : "\n";
+		}
+		cb.InsertString(0, data.c_str(), data.length(), startSequence);
+
+		const auto checkIndex = [&cb]() {
+			std::vector<Sci::Position> startsUTF16(1);
+			std::vector<Sci::Position> startsUTF32(1);
+			for (Sci::Line line = 0; line < cb.Lines(); line++) {
+				const Sci::Position lineStart = cb.LineStart(line);
+				std::string text(cb.LineStart(line + 1) - lineStart, '\0');
+				cb.GetCharRange(text.data(), lineStart, text.length());
+				Sci::Position widthUTF16 = 0;
+				Sci::Position widthUTF32 = 0;
+				for (const char ch : text) {
+					const unsigned char uch = ch;
+					if ((uch & 0xC0) != 0x80) {
+						widthUTF16 += (uch >= 0xF0) ? 2 : 1;
+						widthUTF32++;
+					}
+				}
+				startsUTF16.push_back(startsUTF16.back() + widthUTF16);
+				startsUTF32.push_back(startsUTF32.back() + widthUTF32);
+			}
+
+			// Position query far beyond the counted lines
+			const Sci::Line lineFar = cb.Lines() - 5;
+			REQUIRE(cb.LineFromPositionIndex(startsUTF16[lineFar] + 1, LineCharacterIndexType::Utf16) == lineFar);
+			for (Sci::Line line = 0; line <= cb.Lines(); line++) {
+				REQUIRE(cb.IndexLineStart(line, LineCharacterIndexType::Utf16) == startsUTF16[line]);
+				REQUIRE(cb.IndexLineStart(line, LineCharacterIndexType::Utf32) == startsUTF32[line]);
+			}
+			for (Sci::Line line = 0; line < cb.Lines(); line++) {
+				REQUIRE(cb.LineFromPositionIndex(startsUTF32[line], LineCharacterIndexType::Utf32) == line);
+			}
+		};
+
+		cb.AllocateLineCharacterIndex(LineCharacterIndexType::Utf16 | LineCharacterIndexType::Utf32);
+		REQUIRE(cb.IndexLineStart(10, LineCharacterIndexType::Utf16) == 10 * 11 + 2);
+		// Split the last counted line so line 1024 is an uncounted "X\n" then join them
+		// again by deleting "X" so the CR and LF merge without the line being recalculated
+		cb.InsertString(cb.LineEnd(1023), "\rX", 2, startSequence);
+		REQUIRE(cb.CharAt(cb.LineStart(1024)) == 'X');
+		cb.DeleteChars(cb.LineStart(1024), 1, startSequence);
+		checkIndex();
+
+		// Reallocating starts counting again
+		cb.ReleaseLineCharacterIndex(LineCharacterIndexType::Utf16 | LineCharacterIndexType::Utf32);
+		cb.AllocateLineCharacterIndex(LineCharacterIndexType::Utf16 | LineCharacterIndexType::Utf32);
+		REQUIRE(cb.IndexLineStart(10, LineCharacterIndexType::Utf32) == 10 * 10 + 2);
+
+		// Inside counted lines
+		constexpr std::string_view euro = "\xE2\x82\xAC";
+		cb.InsertString(cb.LineStart(5) + 2, euro.data(), euro.length(), startSequence);
+		cb.InsertString(cb.LineStart(1000), "a\nb", 3, startSequence);
+		// Across the end of the counted lines
+		const Sci::Position acrossStart = cb.LineStart(1000) + 3;
+		cb.DeleteChars(acrossStart, cb.LineStart(1100) + 3 - acrossStart, startSequence);
+		// After the counted lines
+		cb.InsertString(cb.LineStart(2000) + 1, "x\ny\n", 4, startSequence);
+		cb.DeleteChars(cb.LineEnd(2500), 1, startSequence);
+		// Leave the gap inside a 4-byte character on an uncounted line
+		const Sci::Position hwair = cb.LineStart(2200) + 8;
+		cb.InsertString(hwair + 2, "Q", 1, startSequence);
+		cb.DeleteChars(hwair + 2, 1, startSequence);
+		REQUIRE(cb.GapPosition() == hwair + 2);
+		checkIndex();
+	}
 }
 
 TEST_CASE("ChangeHistory") {
@@ -11,6 +11,9 @@
 #include <optional>
 #include <algorithm>
 #include <memory>
+#include <iterator>
+
+#include "ScintillaStructures.h"
 
 #include "Debugging.h"
 
@@ -52,6 +55,21 @@ TEST_CASE("Decoration") {
 		deco->SetValueAt(0, 2);
 		REQUIRE(!deco->Empty());
 	}
+
+	SECTION("OnInRange") {
+		deco->InsertSpace(0, 10);
+		REQUIRE(!deco->OnInRange(0, 10));
+		deco->SetValueAt(4, 2);
+		deco->SetValueAt(5, 3);
+		REQUIRE(deco->OnInRange(0, 10));
+		REQUIRE(deco->OnInRange(4, 5));
+		REQUIRE(deco->OnInRange(3, 5));
+		REQUIRE(deco->OnInRange(5, 6));
+		REQUIRE(!deco->OnInRange(0, 4));
+		REQUIRE(!deco->OnInRange(6, 10));
+		REQUIRE(!deco->OnInRange(6, 20));
+		REQUIRE(!deco->OnInRange(5, 5));
+	}
 }
 
 // Test DecorationList.
@@ -95,4 +113,39 @@ TEST_CASE("DecorationList") {
 		REQUIRE(decol->End(indicatorB, 5) == 6);
 	}
 
+	SECTION("AllOnInRange") {
+		decol->InsertSpace(0, 20);
+		REQUIRE(decol->AllOnInRange(0, 20) == 0);
+		decol->SetCurrentIndicator(indicator);
+		decol->FillRange(2, 1, 3);
+		constexpr int indicatorIme = 33;
+		decol->SetCurrentIndicator(indicatorIme);
+		decol->FillRange(10, 1, 2);
+		REQUIRE(decol->AllOnInRange(0, 20) == ((1ull << indicator) | (1ull << indicatorIme)));
+		REQUIRE(decol->AllOnInRange(0, 10) == (1ull << indicator));
+		REQUIRE(decol->AllOnInRange(5, 10) == 0);
+		REQUIRE(decol->AllOnInRange(11, 12) == (1ull << indicatorIme));
+		REQUIRE(IndicatorInMask(decol->AllOnInRange(11, 12), indicatorIme));
+		REQUIRE(!IndicatorInMask(decol->AllOnInRange(11, 12), indicator));
+	}
+
+	SECTION("FillRanges") {
+		decol->SetCurrentIndicator(indicator);
+		decol->InsertSpace(0, 20);
+		const Scintilla::IndicatorFill fills[] = { {2, 3, 1}, {8, 2, 5}, {15, 5, 1} };
+		auto fr = decol->FillRanges(fills, std::size(fills));
+		REQUIRE(fr.changed);
+		REQUIRE(fr.position == 2);
+		REQUIRE(fr.fillLength == 18);
+		REQUIRE(decol->ValueAt(indicator, 3) == 1);
+		REQUIRE(decol->ValueAt(indicator, 8) == 5);
+		REQUIRE(decol->ValueAt(indicator, 12) == 0);
+		REQUIRE(decol->End(indicator, 15) == 20);
+		const Scintilla::IndicatorFill clears[] = { {0, 10, 0}, {10, 10, 0} };
+		fr = decol->FillRanges(clears, std::size(clears));
+		REQUIRE(fr.changed);
+		// Indicator removed once empty
+		REQUIRE(decol->View().empty());
+	}
+
 }
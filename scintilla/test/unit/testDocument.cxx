@@ -4,7 +4,9 @@
 
 #include <cstddef>
 #include <cstring>
+#include <cstdint>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <vector>
 #include <set>
@@ -28,6 +30,8 @@
 #include "Partitioning.h"
 #include "RunStyles.h"
 #include "CellBuffer.h"
+#include "UniqueString.h"
+#include "ContractionState.h"
 #include "CharClassify.h"
 #include "Decoration.h"
 #include "CaseFolder.h"
@@ -804,6 +808,196 @@ TEST_CASE("DocumentUndo") {
 	}
 }
 
+// Second view of a document that follows modifications like Editor::NotifyModified.
+struct ViewWatcher : public DocWatcher {
+	std::unique_ptr<IContractionState> pcs = ContractionStateCreate(false);
+	Sci::Position caret = 0;
+	std::vector<Range> changed;
+
+	void NotifyModifyAttempt(Document *, void *) override {}
+	void NotifySavePoint(Document *, void *, bool) override {}
+	void NotifyModified(Document *doc, DocModification mh, void *) override {
+		if (FlagSet(mh.modificationType, ModificationFlags::BeforeInsert | ModificationFlags::BeforeDelete)) {
+			changed.emplace_back(mh.position, mh.position + mh.length);
+		}
+		if (FlagSet(mh.modificationType, ModificationFlags::InsertText)) {
+			if (caret > mh.position)
+				caret += mh.length;
+		} else if (FlagSet(mh.modificationType, ModificationFlags::DeleteText)) {
+			if (caret > mh.position)
+				caret = std::max(caret - mh.length, mh.position);
+		}
+		if (mh.linesAdded != 0) {
+			Sci::Line lineOfPos = doc->SciLineFromPosition(mh.position);
+			if (mh.position > doc->LineStart(lineOfPos))
+				lineOfPos++;
+			if (mh.linesAdded > 0) {
+				pcs->InsertLines(lineOfPos, mh.linesAdded);
+			} else {
+				pcs->DeleteLines(lineOfPos, -mh.linesAdded);
+			}
+		}
+	}
+	void NotifyDeleted(Document *, void *) noexcept override {}
+	void NotifyStyleNeeded(Document *, void *, Sci::Position) override {}
+	void NotifyErrorOccurred(Document *, void *, Scintilla::Status) override {}
+};
+
+TEST_CASE("DocumentReplaceRanges") {
+
+	DocPlus doc("a,b,c\nd,e,f", 0);
+
+	SECTION("ReplaceEach") {
+		doc.document.DeleteUndoHistory();
+		std::vector<Replacement> replacements {
+			{1, 1, ";"}, {3, 1, ";;"}, {7, 1, ""}, {9, 1, ";"},
+		};
+		REQUIRE(doc.document.ReplaceRanges(replacements));
+		REQUIRE(doc.Contents() == "a;b;;c\nde;f");
+		REQUIRE(replacements[1].lengthInserted == 2);
+		REQUIRE(doc.document.LinesTotal() == 2);
+		// Whole batch is a single undo step
+		doc.document.Undo();
+		REQUIRE(doc.Contents() == "a,b,c\nd,e,f");
+		REQUIRE(!doc.document.CanUndo());
+		doc.document.Redo();
+		REQUIRE(doc.Contents() == "a;b;;c\nde;f");
+	}
+
+	SECTION("InsertAtSamePosition") {
+		std::vector<Replacement> replacements {
+			{0, 0, "1"}, {0, 0, "2"}, {11, 0, "\n"},
+		};
+		REQUIRE(doc.document.ReplaceRanges(replacements));
+		REQUIRE(doc.Contents() == "12a,b,c\nd,e,f\n");
+		REQUIRE(doc.document.LinesTotal() == 3);
+	}
+
+	SECTION("JoinLines") {
+		std::vector<Replacement> replacements {
+			{0, 1, "x"}, {5, 1, " "},
+		};
+		REQUIRE(doc.document.ReplaceRanges(replacements));
+		REQUIRE(doc.Contents() == "x,b,c d,e,f");
+		REQUIRE(doc.document.LinesTotal() == 1);
+	}
+
+	SECTION("FoldedViewBetweenCarets") {
+		DocPlus folded("a\n{\n b\n c\n}\nz", 0);
+		ViewWatcher view;
+		view.pcs->InsertLines(0, folded.document.LinesTotal() - 1);
+		view.pcs->SetVisible(2, 3, false);
+		view.caret = folded.document.LineStart(3);
+		const Sci::Position foldStart = folded.document.LineStart(1);
+		const Sci::Position foldEnd = folded.document.LineStart(4);
+		folded.document.AddWatcher(&view, nullptr);
+		// Carets on the first and last lines with the folded block between them
+		std::vector<Replacement> replacements {
+			{1, 0, "\n"}, {folded.document.Length() - 1, 1, "y"},
+		};
+		REQUIRE(folded.document.ReplaceRanges(replacements));
+		REQUIRE(folded.Contents() == "a\n\n{\n b\n c\n}\ny");
+		// Only the replaced ranges are reported so the folded lines are left alone
+		for (const Range &range : view.changed) {
+			REQUIRE((range.end <= foldStart || range.start >= foldEnd));
+		}
+		REQUIRE(view.pcs->LinesInDoc() == folded.document.LinesTotal());
+		REQUIRE(view.pcs->GetVisible(2));
+		REQUIRE(!view.pcs->GetVisible(3));
+		REQUIRE(!view.pcs->GetVisible(4));
+		REQUIRE(view.pcs->GetVisible(5));
+		REQUIRE(view.pcs->LinesDisplayed() == 5);
+		REQUIRE(view.caret == folded.document.LineStart(4));
+		folded.document.RemoveWatcher(&view, nullptr);
+	}
+
+	SECTION("RejectInvalid") {
+		std::vector<Replacement> overlapping {
+			{0, 3, "x"}, {2, 1, "y"},
+		};
+		REQUIRE(!doc.document.ReplaceRanges(overlapping));
+		std::vector<Replacement> beyondEnd {
+			{10, 2, "x"},
+		};
+		REQUIRE(!doc.document.ReplaceRanges(beyondEnd));
+		REQUIRE(doc.Contents() == "a,b,c\nd,e,f");
+	}
+}
+
+struct PieceWriter : public TextWriter {
+	std::vector<std::string> pieces;
+	size_t limit = SIZE_MAX;
+	bool Write(std::string_view text) override {
+		if (pieces.size() >= limit) {
+			return false;
+		}
+		pieces.emplace_back(text);
+		return true;
+	}
+	[[nodiscard]] std::string Joined() const {
+		std::string joined;
+		for (const std::string &piece : pieces) {
+			joined += piece;
+		}
+		return joined;
+	}
+};
+
+TEST_CASE("DocumentWriteText") {
+
+	DocPlus doc("ab\r\ncd\ref\ngh\r", 0);
+
+	SECTION("Unchanged") {
+		for (Sci::Position gapPos = 0; gapPos <= doc.document.Length(); gapPos++) {
+			doc.MoveGap(gapPos);
+			PieceWriter writer;
+			REQUIRE(doc.document.WriteText(writer, 4, {}));
+			REQUIRE(writer.Joined() == doc.Contents());
+			for (const std::string &piece : writer.pieces) {
+				REQUIRE(!piece.empty());
+				REQUIRE(piece.length() <= 4);
+			}
+		}
+	}
+
+	SECTION("ConvertLineEnds") {
+		for (Sci::Position gapPos = 0; gapPos <= doc.document.Length(); gapPos++) {
+			doc.MoveGap(gapPos);
+			for (const size_t chunkSize : { 1, 2, 3, 100 }) {
+				PieceWriter writer;
+				REQUIRE(doc.document.WriteText(writer, chunkSize, EndOfLine::Lf));
+				REQUIRE(writer.Joined() == "ab\ncd\nef\ngh\n");
+				writer.pieces.clear();
+				REQUIRE(doc.document.WriteText(writer, chunkSize, EndOfLine::CrLf));
+				REQUIRE(writer.Joined() == "ab\r\ncd\r\nef\r\ngh\r\n");
+				for (const std::string &piece : writer.pieces) {
+					REQUIRE(piece.length() <= std::max<size_t>(chunkSize, 2));
+				}
+				writer.pieces.clear();
+				REQUIRE(doc.document.WriteText(writer, chunkSize, EndOfLine::Cr));
+				REQUIRE(writer.Joined() == "ab\rcd\ref\rgh\r");
+			}
+		}
+	}
+
+	SECTION("StopOnFailure") {
+		PieceWriter writer;
+		writer.limit = 2;
+		REQUIRE(!doc.document.WriteText(writer, 3, {}));
+		REQUIRE(writer.pieces.size() == 2);
+		writer.pieces.clear();
+		REQUIRE(!doc.document.WriteText(writer, 3, EndOfLine::Lf));
+		REQUIRE(writer.pieces.size() == 2);
+	}
+
+	SECTION("Empty") {
+		DocPlus docEmpty("", 0);
+		PieceWriter writer;
+		REQUIRE(docEmpty.document.WriteText(writer, 4, EndOfLine::CrLf));
+		REQUIRE(writer.pieces.empty());
+	}
+}
+
 TEST_CASE("Words") {
 
 	SECTION("WordsInText") {
@@ -3,6 +3,7 @@
  **/
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <string_view>
@@ -115,6 +116,62 @@ TEST_CASE("MarkerHandleSet") {
 	}
 }
 
+TEST_CASE("MarkerLines") {
+
+	MarkerLines ml(100);
+
+	SECTION("Initial") {
+		REQUIRE(0 == ml.Count());
+		REQUIRE(0 == ml.IndexFromLine(0));
+		REQUIRE(!ml.Contains(0));
+		REQUIRE(-1 == ml.IndexFromLabel(0));
+	}
+
+	SECTION("InsertShift") {
+		ml.Insert(0, 0);
+		ml.Insert(1, 50);
+		ml.Insert(1, 20);
+		REQUIRE(3 == ml.Count());
+		REQUIRE(20 == ml.LineFromIndex(1));
+		REQUIRE(1 == ml.IndexFromLine(1));
+		REQUIRE(1 == ml.IndexFromLine(20));
+		REQUIRE(2 == ml.IndexFromLine(21));
+		REQUIRE(3 == ml.IndexFromLine(99));
+		REQUIRE(ml.Contains(0));
+		REQUIRE(ml.Label(0) < ml.Label(1));
+		REQUIRE(ml.Label(1) < ml.Label(2));
+		ml.Shift(20, 5);
+		REQUIRE(0 == ml.LineFromIndex(0));
+		REQUIRE(25 == ml.LineFromIndex(1));
+		REQUIRE(55 == ml.LineFromIndex(2));
+		ml.Shift(0, 1);
+		REQUIRE(1 == ml.LineFromIndex(0));
+		ml.SetLine(1, 24);
+		REQUIRE(24 == ml.LineFromIndex(1));
+		REQUIRE(56 == ml.LineFromIndex(2));
+		const std::uint64_t label = ml.Label(2);
+		ml.Remove(0);
+		REQUIRE(1 == ml.IndexFromLabel(label));
+		REQUIRE(56 == ml.LineFromIndex(1));
+	}
+
+	SECTION("Relabel") {
+		// Repeatedly inserting at the same place exhausts the space between labels
+		ml.Insert(0, 0);
+		ml.Insert(1, 99);
+		const std::uint64_t labelLast = ml.Label(1);
+		bool relabelled = false;
+		for (Sci::Line line = 98; line > 0 && !relabelled; line--) {
+			relabelled = ml.Insert(1, line);
+		}
+		REQUIRE(relabelled);
+		REQUIRE(labelLast != ml.Label(ml.Count() - 1));
+		for (Sci::Line index = 0; index < ml.Count(); index++) {
+			REQUIRE(index == ml.IndexFromLabel(ml.Label(index)));
+		}
+	}
+}
+
 TEST_CASE("LineMarkers") {
 
 	LineMarkers lm;
@@ -157,6 +214,34 @@ TEST_CASE("LineMarkers") {
 		REQUIRE(-1 == line3);
 	}
 
+	SECTION("MarkerNextPreviousLarge") {
+		// Lines far apart with marker numbers sharing mask bits
+		constexpr Sci::Line lines = 300000;
+		lm.AddMark(5, 1, lines);
+		lm.AddMark(70000, 2, lines);
+		lm.AddMark(250001, 1, lines);
+		REQUIRE(5 == lm.MarkerNext(0, 2));
+		REQUIRE(250001 == lm.MarkerNext(6, 2));
+		REQUIRE(70000 == lm.MarkerNext(6, 6));
+		REQUIRE(-1 == lm.MarkerNext(250002, 6));
+		REQUIRE(70000 == lm.MarkerPrevious(250000, 6));
+		REQUIRE(5 == lm.MarkerPrevious(250000, 2));
+		REQUIRE(250001 == lm.MarkerPrevious(lines + 10, 2));
+		REQUIRE(-1 == lm.MarkerPrevious(4, 6));
+		// Lines of each marker number follow inserted and removed lines
+		lm.InsertLines(10, 100);
+		REQUIRE(70100 == lm.MarkerNext(6, 4));
+		REQUIRE(250101 == lm.MarkerPrevious(lines + 100, 2));
+		lm.RemoveLine(70100);
+		REQUIRE(70099 == lm.MarkerNext(6, 4));
+		REQUIRE(lm.DeleteAllMarks(1));
+		REQUIRE(-1 == lm.MarkerNext(0, 2));
+		REQUIRE(70099 == lm.MarkerPrevious(lines, 6));
+		lm.DeleteMark(70099, 2, true);
+		REQUIRE(-1 == lm.MarkerNext(0, ~0));
+		REQUIRE(!lm.DeleteAllMarks(-1));
+	}
+
 	SECTION("MergeMarkers") {
 		lm.AddMark(1, 1, 5);
 		lm.AddMark(2, 2, 5);
@@ -189,6 +274,52 @@ TEST_CASE("LineMarkers") {
 		REQUIRE(1 == lm.LineFromHandle(handle1));
 		REQUIRE(4 == lm.LineFromHandle(handle2));
 	}
+
+	SECTION("LineFromHandle") {
+		lm.InsertLines(0, 5);
+		const int handle1 = lm.AddMark(1, 1, 5);
+		const int handle2 = lm.AddMark(3, 2, 5);
+		const int handle3 = lm.AddMark(3, 2, 5);
+		REQUIRE(3 == lm.LineFromHandle(handle2));
+		lm.InsertLine(0);
+		REQUIRE(2 == lm.LineFromHandle(handle1));
+		REQUIRE(4 == lm.LineFromHandle(handle2));
+		// Removing line with handle1 merges it into previous line
+		lm.RemoveLine(2);
+		REQUIRE(1 == lm.LineFromHandle(handle1));
+		REQUIRE(3 == lm.LineFromHandle(handle3));
+		// Most recent of marker number removed
+		REQUIRE(lm.DeleteMark(3, 2, false));
+		REQUIRE(-1 == lm.LineFromHandle(handle3));
+		REQUIRE(3 == lm.LineFromHandle(handle2));
+		lm.DeleteMarkFromHandle(handle2);
+		REQUIRE(-1 == lm.LineFromHandle(handle2));
+		REQUIRE(0 == lm.MarkValue(3));
+		// Markers on first line are lost when it is removed
+		lm.RemoveLine(0);
+		REQUIRE(0 == lm.LineFromHandle(handle1));
+		lm.RemoveLine(0);
+		REQUIRE(-1 == lm.LineFromHandle(handle1));
+		REQUIRE(-1 == lm.LineFromHandle(99));
+	}
+
+	SECTION("LineFromHandleRelabelled") {
+		// Adding marks from the end backwards between two others forces their lines to be relabelled
+		constexpr Sci::Line lines = 200;
+		std::vector<int> handles;
+		handles.push_back(lm.AddMark(0, 3, lines));
+		handles.push_back(lm.AddMark(199, 3, lines));
+		for (Sci::Line line = 198; line > 0; line--) {
+			handles.push_back(lm.AddMark(line, 3, lines));
+		}
+		lm.InsertLines(50, 10);
+		REQUIRE(0 == lm.LineFromHandle(handles[0]));
+		REQUIRE(209 == lm.LineFromHandle(handles[1]));
+		for (size_t i = 2; i < handles.size(); i++) {
+			const Sci::Line line = 200 - static_cast<Sci::Line>(i);
+			REQUIRE(lm.LineFromHandle(handles[i]) == ((line < 50) ? line : line + 10));
+		}
+	}
 }
 
 TEST_CASE("LineLevels") {
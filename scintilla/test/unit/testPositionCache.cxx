@@ -0,0 +1,150 @@
+/** @file testPositionCache.cxx
+ ** Unit Tests for Scintilla internal data structures
+ **/
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <memory>
+
+#include "ScintillaTypes.h"
+#include "ILoader.h"
+#include "ILexer.h"
+
+#include "Debugging.h"
+#include "Geometry.h"
+#include "Platform.h"
+
+#include "CharacterCategoryMap.h"
+#include "Position.h"
+#include "UniqueString.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "Indicator.h"
+#include "LineMarker.h"
+#include "Style.h"
+#include "ViewStyle.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "Selection.h"
+#include "PositionCache.h"
+
+#include "catch.hpp"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+// Test LineRasterCache. Rasters are stored without surfaces as only their bookkeeping is tested.
+
+TEST_CASE("LineRasterCache") {
+
+	LineRasterCache lrc;
+	lrc.SetEnabled(true);
+	lrc.SetGeometry(10, 400, 16);
+
+	SECTION("IsEmptyInitially") {
+		REQUIRE(lrc.Enabled());
+		REQUIRE(lrc.Count() == 0);
+		REQUIRE(!lrc.Find(0, 0));
+	}
+
+	SECTION("AddAndFind") {
+		LineRaster *raster = lrc.Add(3, 0, {});
+		raster->widthLine = 250;
+		lrc.Add(3, 1, {});
+		REQUIRE(lrc.Count() == 2);
+		REQUIRE(lrc.Find(3, 0) == raster);
+		REQUIRE(lrc.Find(3, 0)->widthLine == 250);
+		REQUIRE(lrc.Find(3, 1));
+		REQUIRE(!lrc.Find(3, 2));
+		REQUIRE(!lrc.Find(4, 0));
+	}
+
+	SECTION("InvalidateLines") {
+		for (Sci::Line line = 0; line < 10; line++) {
+			lrc.Add(line, 0, {});
+			lrc.Add(line, 1, {});
+		}
+		lrc.InvalidateLines(3, 5);
+		REQUIRE(lrc.Count() == 14);
+		REQUIRE(lrc.Find(2, 1));
+		REQUIRE(!lrc.Find(3, 0));
+		REQUIRE(!lrc.Find(5, 1));
+		REQUIRE(lrc.Find(6, 0));
+		// Reversed range does nothing
+		lrc.InvalidateLines(8, 7);
+		REQUIRE(lrc.Count() == 14);
+		lrc.InvalidateLines(8, 100);
+		REQUIRE(lrc.Count() == 10);
+		REQUIRE(lrc.Find(7, 1));
+		REQUIRE(!lrc.Find(8, 0));
+	}
+
+	SECTION("GeometryChangeClears") {
+		lrc.Add(1, 0, {});
+		lrc.SetGeometry(10, 400, 16);
+		REQUIRE(lrc.Count() == 1);
+		lrc.SetGeometry(0, 400, 16);
+		REQUIRE(lrc.Count() == 0);
+		lrc.Add(1, 0, {});
+		lrc.SetGeometry(0, 300, 16);
+		REQUIRE(lrc.Count() == 0);
+		lrc.Add(1, 0, {});
+		lrc.SetGeometry(0, 300, 20);
+		REQUIRE(lrc.Count() == 0);
+	}
+
+	SECTION("TrimLeastRecentlyUsed") {
+		// Each SetGeometry starts a new paint
+		lrc.Add(1, 0, {});
+		lrc.Add(2, 0, {});
+		lrc.SetGeometry(10, 400, 16);
+		lrc.Add(3, 0, {});
+		lrc.Find(1, 0);
+		lrc.SetGeometry(10, 400, 16);
+		lrc.Add(4, 0, {});
+		lrc.Trim(3);
+		REQUIRE(lrc.Count() == 3);
+		REQUIRE(!lrc.Find(2, 0));
+		lrc.Trim(1);
+		REQUIRE(lrc.Count() == 1);
+		REQUIRE(!lrc.Find(1, 0));
+		REQUIRE(!lrc.Find(3, 0));
+		REQUIRE(lrc.Find(4, 0));
+	}
+
+	SECTION("TrimMany") {
+		// Ages interleaved with line order so the oldest are spread through the map
+		for (int paint = 0; paint < 10; paint++) {
+			for (Sci::Line k = 0; k < 100; k++) {
+				lrc.Add(k * 10 + paint, 0, {});
+			}
+			lrc.SetGeometry(10, 400, 16);
+		}
+		lrc.Trim(250);
+		REQUIRE(lrc.Count() == 250);
+		for (Sci::Line k = 0; k < 100; k++) {
+			REQUIRE(!lrc.Find(k * 10 + 6, 0));
+			REQUIRE(lrc.Find(k * 10 + 8, 0));
+			REQUIRE(lrc.Find(k * 10 + 9, 0));
+		}
+	}
+
+	SECTION("DisableClears") {
+		lrc.Add(1, 0, {});
+		lrc.SetEnabled(false);
+		REQUIRE(!lrc.Enabled());
+		REQUIRE(lrc.Count() == 0);
+	}
+}
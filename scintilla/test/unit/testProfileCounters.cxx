@@ -0,0 +1,62 @@
+/** @file testProfileCounters.cxx
+ ** Unit Tests for Scintilla internal data structures
+ **/
+
+#include "ProfileCounters.h"
+
+#include "catch.hpp"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+// Test ProfileCounters.
+
+TEST_CASE("ProfileCounters") {
+
+	ProfileCounters profile;
+
+	SECTION("IsEmptyInitially") {
+		REQUIRE(profile.Get(ProfileCounter::Paints) == 0);
+		REQUIRE(profile.Get(ProfileCounter::IdleTime) == 0);
+	}
+
+	SECTION("Add") {
+		profile.Add(ProfileCounter::LinesLaidOut, 3);
+		profile.Add(ProfileCounter::LinesLaidOut, 4);
+		profile.Add(ProfileCounter::StyledBytes, 100);
+		REQUIRE(profile.Get(ProfileCounter::LinesLaidOut) == 7);
+		REQUIRE(profile.Get(ProfileCounter::StyledBytes) == 100);
+		REQUIRE(profile.Get(ProfileCounter::MeasuredRuns) == 0);
+	}
+
+	SECTION("DurationsInMicroseconds") {
+		// Short durations accumulate rather than being rounded away
+		for (int i = 0; i < 1000; i++) {
+			profile.AddDuration(ProfileCounter::LayoutTime, 0.0000005);
+		}
+		profile.AddDuration(ProfileCounter::PaintTime, 0.25);
+		REQUIRE(profile.Get(ProfileCounter::LayoutTime) == 500);
+		REQUIRE(profile.Get(ProfileCounter::PaintTime) == 250000);
+	}
+
+	SECTION("Reset") {
+		profile.Add(ProfileCounter::Paints, 2);
+		profile.AddDuration(ProfileCounter::WrapTime, 1.0);
+		profile.Reset();
+		REQUIRE(profile.Get(ProfileCounter::Paints) == 0);
+		REQUIRE(profile.Get(ProfileCounter::WrapTime) == 0);
+	}
+
+	SECTION("OutOfRange") {
+		REQUIRE(profile.Get(static_cast<ProfileCounter>(-1)) == 0);
+		REQUIRE(profile.Get(static_cast<ProfileCounter>(100)) == 0);
+	}
+
+	SECTION("Duration") {
+		{
+			const ProfileDuration pd(profile, ProfileCounter::IdleTime);
+		}
+		REQUIRE(profile.Get(ProfileCounter::IdleTime) >= 0);
+		REQUIRE(profile.Get(ProfileCounter::Paints) == 0);
+	}
+}
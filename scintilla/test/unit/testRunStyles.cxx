@@ -11,6 +11,7 @@
 #include <optional>
 #include <algorithm>
 #include <memory>
+#include <iterator>
 
 #include "Debugging.h"
 
@@ -27,6 +28,16 @@ using namespace Scintilla::Internal;
 
 using UniqueInt = std::unique_ptr<int>;
 
+namespace {
+
+struct Fill {
+	int position;
+	int fillLength;
+	int value;
+};
+
+}
+
 TEST_CASE("CompileCopying RunStyles") {
 
 	// These are compile-time tests to check that basic copy and move
@@ -378,4 +389,97 @@ TEST_CASE("RunStyles") {
 		REQUIRE(1 == rs.EndRun(0));
 	}
 
+	SECTION("FillRanges") {
+		rs.InsertSpace(0, 10);
+		const Fill fills[] = { {1, 2, 99}, {3, 1, 99}, {6, 2, 5}, {9, 1, 7} };
+		const auto fr = rs.FillRanges(fills, std::size(fills));
+		REQUIRE(FillResult<int>{true, 1, 9} == fr);
+		REQUIRE(10 == rs.Length());
+		REQUIRE(6 == rs.Runs());
+		REQUIRE(0 == rs.ValueAt(0));
+		REQUIRE(99 == rs.ValueAt(1));
+		REQUIRE(99 == rs.ValueAt(3));
+		REQUIRE(1 == rs.StartRun(2));
+		REQUIRE(4 == rs.EndRun(2));
+		REQUIRE(0 == rs.ValueAt(5));
+		REQUIRE(5 == rs.ValueAt(6));
+		REQUIRE(5 == rs.ValueAt(7));
+		REQUIRE(0 == rs.ValueAt(8));
+		REQUIRE(7 == rs.ValueAt(9));
+		rs.Check();
+	}
+
+	SECTION("FillRangesAlreadyFilled") {
+		rs.InsertSpace(0, 10);
+		rs.FillRange(2, 99, 4);
+		const Fill fills[] = { {2, 1, 99}, {4, 2, 99}, {8, 2, 0} };
+		const auto fr = rs.FillRanges(fills, std::size(fills));
+		REQUIRE(false == fr.changed);
+		REQUIRE(3 == rs.Runs());
+		rs.Check();
+	}
+
+	SECTION("FillRangesClear") {
+		rs.InsertSpace(0, 10);
+		rs.FillRange(2, 99, 4);
+		rs.FillRange(7, 3, 2);
+		const Fill fills[] = { {0, 6, 0}, {6, 4, 0} };
+		const auto fr = rs.FillRanges(fills, std::size(fills));
+		REQUIRE(true == fr.changed);
+		REQUIRE(1 == rs.Runs());
+		REQUIRE(rs.AllSameAs(0));
+		rs.Check();
+	}
+
+	SECTION("FillRangesOutsideBounds") {
+		rs.InsertSpace(0, 5);
+		const Fill fills[] = { {-1, 2, 99}, {1, 0, 99}, {2, 1, 99}, {4, 2, 99} };
+		const auto fr = rs.FillRanges(fills, std::size(fills));
+		REQUIRE(FillResult<int>{true, 2, 1} == fr);
+		REQUIRE(3 == rs.Runs());
+		REQUIRE(99 == rs.ValueAt(2));
+		REQUIRE(0 == rs.ValueAt(4));
+		rs.Check();
+	}
+
+	SECTION("FillRangesUnsorted") {
+		// Overlapping ranges apply in order as separate fills would
+		rs.InsertSpace(0, 10);
+		const Fill fills[] = { {5, 3, 2}, {1, 6, 3} };
+		const auto fr = rs.FillRanges(fills, std::size(fills));
+		REQUIRE(FillResult<int>{true, 1, 7} == fr);
+		REQUIRE(3 == rs.ValueAt(6));
+		REQUIRE(2 == rs.ValueAt(7));
+		REQUIRE(0 == rs.ValueAt(8));
+		rs.Check();
+	}
+
+	SECTION("FillRangesSameAsFillRange") {
+		// Merging sorted ranges matches filling each range separately
+		RunStyles<int, int> rsSeparate;
+		rs.InsertSpace(0, 200);
+		rsSeparate.InsertSpace(0, 200);
+		for (int i = 0; i < 200; i += 7) {
+			rs.FillRange(i, i % 3, 4);
+			rsSeparate.FillRange(i, i % 3, 4);
+		}
+		std::vector<Fill> fills;
+		unsigned int seed = 1;
+		for (int position = 0; position < 200;) {
+			seed = seed * 1103515245 + 12345;
+			const int fillLength = std::min(static_cast<int>((seed >> 16) % 9), 200 - position);
+			fills.push_back({ position, fillLength, static_cast<int>((seed >> 8) % 3) });
+			position += fillLength + static_cast<int>((seed >> 4) % 4);
+		}
+		rs.FillRanges(fills.data(), fills.size());
+		for (const Fill &fill : fills) {
+			rsSeparate.FillRange(fill.position, fill.value, fill.fillLength);
+		}
+		REQUIRE(rsSeparate.Runs() == rs.Runs());
+		for (int i = 0; i < 200; i++) {
+			REQUIRE(rsSeparate.ValueAt(i) == rs.ValueAt(i));
+		}
+		rs.Check();
+	}
+
 }
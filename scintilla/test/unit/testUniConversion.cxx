@@ -5,6 +5,9 @@
 #include <cstring>
 #include <string>
 #include <string_view>
+#include <vector>
+#include <iterator>
+#include <random>
 #include "UniConversion.h"
 #include "catch.hpp"
 
@@ -350,3 +353,106 @@ TEST_CASE("UTF8Classify") {
 		REQUIRE(UTFClass("\xF0\x9F\x9Fq") == (1 | UTF8MaskInvalid));
 	}
 }
+
+namespace {
+
+// Text made of pieces that exercise the vector kernels: ASCII runs, valid characters of
+// each length, non-characters, and invalid or truncated sequences.
+std::string MixedText(std::mt19937 &generator, size_t pieces, bool allowInvalid) {
+	static constexpr std::string_view validPieces[] = {
+		"a", "Hello, World ", "0123456789abcdefghijklmnopqrstuvwxyz", "\t\r\n",
+		"\xC2\xA9", "\xD0\x96", "\xE2\x82\xAC", "\xE4\xB8\xAD\xE6\x96\x87", "\xEF\xBF\xBD",
+		"\xF0\x9F\x8C\x90", "\xF4\x8F\xBF\xBD", "\xE0\xBF\xBA", "\xEF\xB7\x8F",
+	};
+	static constexpr std::string_view invalidPieces[] = {
+		// Non-characters U+FFFE, U+FFFF, U+FDD0, U+1FFFF
+		"\xEF\xBF\xBE", "\xEF\xBF\xBF", "\xEF\xB7\x90", "\xF0\x9F\xBF\xBF",
+		// Lone trail, bad leads, overlong, surrogate, too large, truncated
+		"\x80", "\xC0\xAF", "\xFF", "\xE0\x80\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80",
+		"\xC3", "\xE2\x82", "\xF0\x9F\x8C",
+	};
+	std::string text;
+	for (size_t piece = 0; piece < pieces; piece++) {
+		if (allowInvalid && (generator() % 8 == 0)) {
+			text += invalidPieces[generator() % std::size(invalidPieces)];
+		} else {
+			text += validPieces[generator() % std::size(validPieces)];
+		}
+	}
+	return text;
+}
+
+void CheckKernels(std::string_view text) {
+	REQUIRE(UTF8IsValid(text) == UTF8IsValidReference(text));
+	REQUIRE(UTF16Length(text) == UTF16LengthReference(text));
+	REQUIRE(UTF32Length(text) == UTF32LengthReference(text));
+
+	const size_t lengthUTF16 = UTF16LengthReference(text);
+	std::wstring converted(lengthUTF16 + 1, L'\0');
+	std::wstring reference(lengthUTF16 + 1, L'\0');
+	REQUIRE(UTF16FromUTF8(text, converted.data(), lengthUTF16) ==
+		UTF16FromUTF8Reference(text, reference.data(), lengthUTF16));
+	REQUIRE(converted == reference);
+
+	const size_t lengthUTF32 = UTF32LengthReference(text);
+	std::vector<unsigned int> converted32(lengthUTF32 + 1);
+	std::vector<unsigned int> reference32(lengthUTF32 + 1);
+	REQUIRE(UTF32FromUTF8(text, converted32.data(), lengthUTF32) ==
+		UTF32FromUTF8Reference(text, reference32.data(), lengthUTF32));
+	REQUIRE(converted32 == reference32);
+
+	const std::string fixed = FixInvalidUTF8(std::string(text));
+	REQUIRE(UTF8IsValidReference(fixed));
+	if (UTF8IsValidReference(text)) {
+		REQUIRE(fixed == text);
+	}
+}
+
+}
+
+TEST_CASE("UTF8Kernels") {
+
+	const UTF8Kernels kernelsStart = UTF8KernelsActive();
+	std::vector<UTF8Kernels> kernelSets { UTF8Kernels::Portable };
+	if (SetUTF8Kernels(UTF8Kernels::AVX2)) {
+		kernelSets.push_back(UTF8Kernels::AVX2);
+	}
+
+	SECTION("Problem at every offset of 2 vectors") {
+		// Place each invalid sequence or non-character at each position that may
+		// straddle a block boundary
+		constexpr std::string_view problems[] = {
+			"\xEF\xBF\xBE", "\xF0\x9F\xBF\xBF", "\xEF\xB7\x90", "\x80", "\xE2\x82", "\xF0\x9F\x8C",
+			"\xE0\x80\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80",
+		};
+		for (const UTF8Kernels kernels : kernelSets) {
+			REQUIRE(SetUTF8Kernels(kernels));
+			for (const std::string_view problem : problems) {
+				for (size_t offset = 0; offset < 64; offset++) {
+					std::string text(offset, 'x');
+					text += problem;
+					CheckKernels(text);
+					text.append(64, '\xE2');
+					text.resize(text.length() - 1);
+					CheckKernels(text);
+					text.resize(offset + problem.length());
+					text += "\xE2\x82\xAC" "0123456789abcdef0123456789abcdef0123456789abcdef";
+					CheckKernels(text);
+				}
+			}
+		}
+	}
+
+	SECTION("Random text") {
+		std::mt19937 generator(20260615);
+		for (const UTF8Kernels kernels : kernelSets) {
+			REQUIRE(SetUTF8Kernels(kernels));
+			for (int i = 0; i < 2000; i++) {
+				const std::string text = MixedText(generator, generator() % 60, i % 2 == 0);
+				CheckKernels(text);
+			}
+		}
+	}
+
+	SetUTF8Kernels(kernelsStart);
+}